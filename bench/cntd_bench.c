@@ -0,0 +1,259 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Microbenchmark of the interception overhead of COUNTDOWN.
+// Every kernel runs a loop of MPI calls of one class and reports the time per
+// call in nanoseconds, with the 95% confidence interval over the repetitions.
+// The same binary is run with and without libcntd.so in LD_PRELOAD by
+// cntd_bench.sh, the overhead is the difference between the two runs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+#include <mpi.h>
+
+#define DEFAULT_ITERATIONS		10000
+#define DEFAULT_REPETITIONS		20
+#define BENCH_TAG				1000
+
+typedef struct
+{
+	const char *name;
+	int calls_per_iter;
+	void (*run)(int iterations);
+} bench_kernel_t;
+
+static int world_rank;
+static int world_size;
+
+static double read_ns()
+{
+	struct timespec sample;
+	clock_gettime(CLOCK_MONOTONIC, &sample);
+	return (double) sample.tv_sec * 1.0E9 + (double) sample.tv_nsec;
+}
+
+// Two-sided 95% quantile of the Student t distribution
+static double student_t95(int df)
+{
+	static const double t95[] = {
+		12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+		2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+		2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+	if(df < 1)
+		return 0;
+	if(df <= (int) (sizeof(t95) / sizeof(t95[0])))
+		return t95[df - 1];
+	return 1.960;
+}
+
+// Small-message ping-pong between rank 0 and rank 1
+static void run_pingpong(int iterations)
+{
+	int i;
+	char buf[8] = {0};
+
+	if(world_rank == 0)
+	{
+		for(i = 0; i < iterations; i++)
+		{
+			MPI_Send(buf, sizeof(buf), MPI_BYTE, 1, BENCH_TAG, MPI_COMM_WORLD);
+			MPI_Recv(buf, sizeof(buf), MPI_BYTE, 1, BENCH_TAG, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+		}
+	}
+	else if(world_rank == 1)
+	{
+		for(i = 0; i < iterations; i++)
+		{
+			MPI_Recv(buf, sizeof(buf), MPI_BYTE, 0, BENCH_TAG, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+			MPI_Send(buf, sizeof(buf), MPI_BYTE, 0, BENCH_TAG, MPI_COMM_WORLD);
+		}
+	}
+}
+
+// MPI_Test polling on a receive that is matched only after the loop
+static void run_test(int iterations)
+{
+	int i, flag;
+	char sbuf[8] = {0}, rbuf[8];
+	MPI_Request request;
+
+	MPI_Irecv(rbuf, sizeof(rbuf), MPI_BYTE, world_rank, BENCH_TAG, MPI_COMM_WORLD, &request);
+	for(i = 0; i < iterations; i++)
+		MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
+	MPI_Send(sbuf, sizeof(sbuf), MPI_BYTE, world_rank, BENCH_TAG, MPI_COMM_WORLD);
+	MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
+static void run_allreduce(int iterations)
+{
+	int i;
+	double in = 1.0, out;
+
+	for(i = 0; i < iterations; i++)
+		MPI_Allreduce(&in, &out, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+}
+
+static void run_barrier(int iterations)
+{
+	int i;
+
+	for(i = 0; i < iterations; i++)
+		MPI_Barrier(MPI_COMM_WORLD);
+}
+
+static void run_accessory(int iterations)
+{
+	int i, rank;
+
+	for(i = 0; i < iterations; i++)
+		MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+}
+
+static bench_kernel_t kernels[] = {
+	{"pingpong",	2,	run_pingpong},
+	{"test",		1,	run_test},
+	{"allreduce",	1,	run_allreduce},
+	{"barrier",		1,	run_barrier},
+	{"accessory",	1,	run_accessory}};
+
+static void usage(const char *prog)
+{
+	unsigned int i;
+
+	fprintf(stderr, "Usage: %s [-l label] [-n iterations] [-r repetitions] [-k kernel]\n", prog);
+	fprintf(stderr, "Kernels:");
+	for(i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++)
+		fprintf(stderr, " %s", kernels[i].name);
+	fprintf(stderr, "\n");
+}
+
+int main(int argc, char *argv[])
+{
+	int opt, i, j;
+	int iterations = DEFAULT_ITERATIONS;
+	int repetitions = DEFAULT_REPETITIONS;
+	const char *label = "baseline";
+	const char *only = NULL;
+
+	MPI_Init(&argc, &argv);
+	MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+
+	while((opt = getopt(argc, argv, "l:n:r:k:h")) != -1)
+	{
+		switch(opt)
+		{
+			case 'l':
+				label = optarg;
+				break;
+			case 'n':
+				iterations = atoi(optarg);
+				break;
+			case 'r':
+				repetitions = atoi(optarg);
+				break;
+			case 'k':
+				only = optarg;
+				break;
+			default:
+				if(world_rank == 0)
+					usage(argv[0]);
+				MPI_Finalize();
+				return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+	if(iterations < 1 || repetitions < 2)
+	{
+		if(world_rank == 0)
+			fprintf(stderr, "Error: at least 1 iteration and 2 repetitions are required\n");
+		MPI_Finalize();
+		return EXIT_FAILURE;
+	}
+
+	double *sample = (double *) malloc(repetitions * sizeof(double));
+	if(sample == NULL)
+	{
+		fprintf(stderr, "Error: failed to allocate %d samples\n", repetitions);
+		MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	if(world_rank == 0)
+		printf("label;kernel;ranks;iterations;repetitions;mean_ns;ci95_ns;min_ns\n");
+
+	for(i = 0; i < (int) (sizeof(kernels) / sizeof(kernels[0])); i++)
+	{
+		if(only != NULL && strcmp(only, kernels[i].name) != 0)
+			continue;
+		if(kernels[i].run == run_pingpong && world_size < 2)
+			continue;
+
+		// Warm up connections, caches and the COUNTDOWN tables
+		MPI_Barrier(MPI_COMM_WORLD);
+		kernels[i].run(iterations / 10 + 1);
+
+		for(j = 0; j < repetitions; j++)
+		{
+			MPI_Barrier(MPI_COMM_WORLD);
+			double start = read_ns();
+			kernels[i].run(iterations);
+			double end = read_ns();
+			sample[j] = (end - start) / ((double) iterations * kernels[i].calls_per_iter);
+		}
+
+		if(world_rank == 0)
+		{
+			double mean = 0, var = 0, min = sample[0];
+			for(j = 0; j < repetitions; j++)
+			{
+				mean += sample[j];
+				if(sample[j] < min)
+					min = sample[j];
+			}
+			mean /= repetitions;
+			for(j = 0; j < repetitions; j++)
+				var += (sample[j] - mean) * (sample[j] - mean);
+			var /= repetitions - 1;
+
+			printf("%s;%s;%d;%d;%d;%.1f;%.1f;%.1f\n",
+				label, kernels[i].name, world_size, iterations, repetitions,
+				mean, student_t95(repetitions - 1) * sqrt(var / repetitions), min);
+			fflush(stdout);
+		}
+	}
+
+	free(sample);
+	MPI_Finalize();
+	return EXIT_SUCCESS;
+}
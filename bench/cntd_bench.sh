@@ -0,0 +1,88 @@
+#!/bin/bash
+#
+# Copyright (c), CINECA, UNIBO, and ETH Zurich
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#			* Redistributions of source code must retain the above copyright notice, this
+#				list of conditions and the following disclaimer.
+#
+#			* Redistributions in binary form must reproduce the above copyright notice,
+#				this list of conditions and the following disclaimer in the documentation
+#				and/or other materials provided with the distribution.
+#
+#			* Neither the name of the copyright holder nor the names of its
+#				contributors may be used to endorse or promote products derived from
+#				this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Run cntd_bench on a single node without COUNTDOWN and with COUNTDOWN in
+# every mode, then print the overhead per MPI call against the baseline.
+#
+# Environment:
+#   CNTD_LIB      path of libcntd.so (default: ../lib or ../src of this script)
+#   CNTD_BENCH_NP number of MPI ranks (default: 2)
+#   MPIRUN        launcher command (default: mpirun)
+# Extra arguments are forwarded to cntd_bench (e.g. -n 100000 -r 30).
+
+BENCH_DIR=$(cd "$(dirname "$0")" && pwd)
+BENCH=${BENCH_DIR}/cntd_bench
+NP=${CNTD_BENCH_NP:-2}
+MPIRUN=${MPIRUN:-mpirun}
+
+if [ -z "${CNTD_LIB}" ]; then
+	for lib in "${BENCH_DIR}/../lib/libcntd.so" "${BENCH_DIR}/../src/libcntd.so"; do
+		if [ -f "${lib}" ]; then
+			CNTD_LIB=${lib}
+			break
+		fi
+	done
+fi
+if [ ! -f "${CNTD_LIB}" ]; then
+	echo "Error: libcntd.so not found, set CNTD_LIB" >&2
+	exit 1
+fi
+
+OUT_DIR=$(mktemp -d)
+trap 'rm -rf "${OUT_DIR}"' EXIT
+
+run_mode() {
+	local label=$1
+	shift
+	env CNTD_OUTPUT_DIR="${OUT_DIR}" "$@" \
+		${MPIRUN} -np ${NP} "${BENCH}" -l ${label} ${BENCH_ARGS} \
+		| grep "^${label};" >> "${OUT_DIR}/results.csv" || exit 1
+}
+
+BENCH_ARGS="$*"
+
+echo "label;kernel;ranks;iterations;repetitions;mean_ns;ci95_ns;min_ns" > "${OUT_DIR}/results.csv"
+run_mode baseline
+run_mode profiling LD_PRELOAD=${CNTD_LIB}
+run_mode analysis LD_PRELOAD=${CNTD_LIB} CNTD_ENABLE=analysis
+run_mode eam LD_PRELOAD=${CNTD_LIB} CNTD_ENABLE=on
+run_mode slack LD_PRELOAD=${CNTD_LIB} CNTD_SLACK_ENABLE=on
+
+cat "${OUT_DIR}/results.csv"
+echo
+
+# Overhead against the baseline, the confidence intervals are combined in quadrature
+awk -F';' '
+	NR == 1 { next }
+	$1 == "baseline" { base[$2] = $6; base_ci[$2] = $7; next }
+	($2 in base) {
+		printf("%-10s %-10s %10.1f ns +/- %.1f ns\n", $1, $2,
+			$6 - base[$2], sqrt($7 * $7 + base_ci[$2] * base_ci[$2]))
+	}' "${OUT_DIR}/results.csv" | { echo "mode       kernel       overhead per call"; cat; }
@@ -470,12 +470,15 @@ HIDDEN void init_arch_conf()
 	else
 		cntd->node.num_cpus = hwloc_get_nbobjs_by_depth(topology, depth);
 
+	// Get cpu id and socket id
+	cntd->rank->cpu_id = sched_getcpu();
+	hwloc_obj_t pu = hwloc_get_pu_obj_by_os_index(topology, cntd->rank->cpu_id);
+	hwloc_obj_t package = pu != NULL ? hwloc_get_ancestor_obj_by_type(topology, HWLOC_OBJ_SOCKET, pu) : NULL;
+	cntd->rank->socket_id = package != NULL ? (int) package->os_index : 0;
+
 	//Destroy topology object
  	hwloc_topology_destroy(topology);
 
-	// Get cpu id
-	cntd->rank->cpu_id = sched_getcpu();
-
 
 	if(cntd->enable_eam_freq)
 	{
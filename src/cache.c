@@ -0,0 +1,390 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+// Open-addressing caches of communicator and datatype sizes. Entries are
+// invalidated through attribute delete callbacks when the handle is freed.
+// A thread claims an invalid slot by moving its state to CACHE_BUSY, then
+// writes the handle and the size and publishes them with CACHE_VALID.
+#define CACHE_INVALID					0
+#define CACHE_BUSY						1
+#define CACHE_VALID						2
+
+typedef struct
+{
+	MPI_Comm comm;
+	int size;
+	// Same group as MPI_COMM_WORLD in the same order
+	int world;
+	int state;
+	// World ranks of the (remote) group, built on the first translation
+	int *world_ranks;
+	int world_ranks_size;
+	// Hash of the world ranks, 0 until first requested
+	uint64_t group_id;
+} CNTD_CommCache_t;
+
+typedef struct
+{
+	MPI_Datatype type;
+	MPI_Count size;
+	int state;
+} CNTD_TypeCache_t;
+
+static CNTD_CommCache_t comm_cache[COMM_CACHE_SIZE];
+static CNTD_TypeCache_t type_cache[TYPE_CACHE_SIZE];
+static int comm_keyval = MPI_KEYVAL_INVALID;
+static int type_keyval = MPI_KEYVAL_INVALID;
+
+static inline unsigned int hash_handle(uintptr_t handle, unsigned int size)
+{
+	return (unsigned int) ((handle * 0x9E3779B97F4A7C15ULL) >> 32) & (size - 1);
+}
+
+// The rank translation is kept until the slot is claimed again
+static int comm_cache_delete(MPI_Comm comm, int keyval, void *attribute_val, void *extra_state)
+{
+	__atomic_store_n(&((CNTD_CommCache_t *) attribute_val)->state, CACHE_INVALID, __ATOMIC_RELEASE);
+	return MPI_SUCCESS;
+}
+
+static int type_cache_delete(MPI_Datatype type, int keyval, void *attribute_val, void *extra_state)
+{
+	__atomic_store_n(&((CNTD_TypeCache_t *) attribute_val)->state, CACHE_INVALID, __ATOMIC_RELEASE);
+	return MPI_SUCCESS;
+}
+
+// Only one thread wins an invalid slot
+static inline int claim_slot(int *state)
+{
+	int expected = CACHE_INVALID;
+
+	return __atomic_compare_exchange_n(state, &expected, CACHE_BUSY,
+		FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static int compare_world(MPI_Comm comm)
+{
+	int result;
+
+	PMPI_Comm_compare(comm, MPI_COMM_WORLD, &result);
+	return result == MPI_IDENT || result == MPI_CONGRUENT;
+}
+
+// Return the valid cache entry of the communicator, NULL if the cache is full
+// or another thread is filling the slot
+static CNTD_CommCache_t* lookup_comm(MPI_Comm comm)
+{
+	int i, state;
+	MPI_Comm key;
+	unsigned int h = hash_handle((uintptr_t) comm, COMM_CACHE_SIZE);
+	CNTD_CommCache_t *entry, *free_entry = NULL;
+
+	for(i = 0; i < COMM_CACHE_SIZE; i++)
+	{
+		entry = &comm_cache[h];
+		key = __atomic_load_n(&entry->comm, __ATOMIC_ACQUIRE);
+		state = __atomic_load_n(&entry->state, __ATOMIC_ACQUIRE);
+		if(key == comm)
+		{
+			if(state == CACHE_VALID)
+				return entry;
+			if(state == CACHE_INVALID)
+				free_entry = entry;
+			break;
+		}
+		if(key == MPI_COMM_NULL)
+		{
+			if(free_entry == NULL)
+				free_entry = entry;
+			break;
+		}
+		// Slots of freed communicators can be reused
+		if(state == CACHE_INVALID && free_entry == NULL)
+			free_entry = entry;
+		h = (h + 1) & (COMM_CACHE_SIZE - 1);
+	}
+
+	if(free_entry == NULL || !claim_slot(&free_entry->state))
+		return NULL;
+
+	free(__atomic_exchange_n(&free_entry->world_ranks, NULL, __ATOMIC_ACQ_REL));
+	__atomic_store_n(&free_entry->group_id, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&free_entry->comm, comm, __ATOMIC_RELEASE);
+	PMPI_Comm_size(comm, &free_entry->size);
+	free_entry->world = compare_world(comm);
+	__atomic_store_n(&free_entry->state, CACHE_VALID, __ATOMIC_RELEASE);
+	PMPI_Comm_set_attr(comm, comm_keyval, free_entry);
+	return free_entry;
+}
+
+HIDDEN int get_comm_size(MPI_Comm comm)
+{
+	int size;
+	CNTD_CommCache_t *entry = lookup_comm(comm);
+
+	if(entry != NULL)
+		return entry->size;
+
+	PMPI_Comm_size(comm, &size);
+	return size;
+}
+
+HIDDEN int is_comm_world(MPI_Comm comm)
+{
+	CNTD_CommCache_t *entry;
+
+	if(comm == MPI_COMM_WORLD)
+		return TRUE;
+
+	entry = lookup_comm(comm);
+	if(entry != NULL)
+		return entry->world;
+	return compare_world(comm);
+}
+
+// Ranks of the remote group for intercommunicators
+static int* translate_ranks(MPI_Comm comm, int *size)
+{
+	int i, inter;
+	int *ranks, *world_ranks;
+	MPI_Group group, world_group;
+
+	PMPI_Comm_test_inter(comm, &inter);
+	if(inter)
+		PMPI_Comm_remote_group(comm, &group);
+	else
+		PMPI_Comm_group(comm, &group);
+	PMPI_Comm_group(MPI_COMM_WORLD, &world_group);
+	PMPI_Group_size(group, size);
+
+	ranks = (int *) malloc(*size * sizeof(int));
+	world_ranks = (int *) malloc(*size * sizeof(int));
+	if(ranks != NULL && world_ranks != NULL)
+	{
+		for(i = 0; i < *size; i++)
+			ranks[i] = i;
+		PMPI_Group_translate_ranks(group, *size, ranks, world_group, world_ranks);
+	}
+	else
+	{
+		free(world_ranks);
+		world_ranks = NULL;
+	}
+	free(ranks);
+
+	PMPI_Group_free(&group);
+	PMPI_Group_free(&world_group);
+	return world_ranks;
+}
+
+// World ranks of the group of a cached communicator. The translation is
+// published once, concurrent builders drop theirs.
+static int* get_cached_world_ranks(CNTD_CommCache_t *entry, MPI_Comm comm, int *size)
+{
+	int *world_ranks, *expected = NULL;
+
+	world_ranks = __atomic_load_n(&entry->world_ranks, __ATOMIC_ACQUIRE);
+	if(world_ranks == NULL)
+	{
+		world_ranks = translate_ranks(comm, size);
+		if(world_ranks == NULL)
+			return NULL;
+		__atomic_store_n(&entry->world_ranks_size, *size, __ATOMIC_RELAXED);
+		if(!__atomic_compare_exchange_n(&entry->world_ranks, &expected, world_ranks,
+			FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			free(world_ranks);
+			world_ranks = expected;
+		}
+	}
+	*size = __atomic_load_n(&entry->world_ranks_size, __ATOMIC_RELAXED);
+	return world_ranks;
+}
+
+HIDDEN int get_world_rank(MPI_Comm comm, int rank)
+{
+	int size, world_rank;
+	int *world_ranks;
+	CNTD_CommCache_t *entry;
+
+	if(comm == MPI_COMM_WORLD || rank < 0)
+		return rank;
+
+	entry = lookup_comm(comm);
+	if(entry != NULL)
+	{
+		world_ranks = get_cached_world_ranks(entry, comm, &size);
+		if(world_ranks == NULL || rank >= size)
+			return MPI_UNDEFINED;
+		return world_ranks[rank];
+	}
+
+	// Cache full, translate without caching
+	world_ranks = translate_ranks(comm, &size);
+	world_rank = (world_ranks != NULL && rank < size) ? world_ranks[rank] : MPI_UNDEFINED;
+	free(world_ranks);
+	return world_rank;
+}
+
+// FNV-1a hash of the world ranks of the group in order, never 0
+static uint64_t hash_group(const int *world_ranks, int size)
+{
+	int i;
+	uint64_t h = 0xCBF29CE484222325ULL;
+
+	for(i = 0; i < size; i++)
+	{
+		h ^= (uint32_t) world_ranks[i];
+		h *= 0x100000001B3ULL;
+	}
+	return h != 0 ? h : 1;
+}
+
+// Identifier of the group of a communicator, the same on all its ranks and
+// different for different groups with the same leader and size. 0 if the
+// group cannot be translated to MPI_COMM_WORLD.
+HIDDEN uint64_t get_comm_group_id(MPI_Comm comm)
+{
+	int size;
+	int *world_ranks;
+	uint64_t group_id;
+	CNTD_CommCache_t *entry = lookup_comm(comm);
+
+	if(entry != NULL)
+	{
+		group_id = __atomic_load_n(&entry->group_id, __ATOMIC_ACQUIRE);
+		if(group_id == 0)
+		{
+			world_ranks = get_cached_world_ranks(entry, comm, &size);
+			if(world_ranks == NULL)
+				return 0;
+			group_id = hash_group(world_ranks, size);
+			__atomic_store_n(&entry->group_id, group_id, __ATOMIC_RELEASE);
+		}
+		return group_id;
+	}
+
+	// Cache full, translate without caching
+	world_ranks = translate_ranks(comm, &size);
+	if(world_ranks == NULL)
+		return 0;
+	group_id = hash_group(world_ranks, size);
+	free(world_ranks);
+	return group_id;
+}
+
+HIDDEN MPI_Count get_type_size(MPI_Datatype type)
+{
+	int i, state;
+	MPI_Count size;
+	MPI_Datatype key;
+	int num_int, num_addr, num_dt, combiner;
+	unsigned int h = hash_handle((uintptr_t) type, TYPE_CACHE_SIZE);
+	CNTD_TypeCache_t *entry, *free_entry = NULL;
+
+	for(i = 0; i < TYPE_CACHE_SIZE; i++)
+	{
+		entry = &type_cache[h];
+		key = __atomic_load_n(&entry->type, __ATOMIC_ACQUIRE);
+		state = __atomic_load_n(&entry->state, __ATOMIC_ACQUIRE);
+		if(key == type)
+		{
+			if(state == CACHE_VALID)
+				return entry->size;
+			if(state == CACHE_INVALID)
+				free_entry = entry;
+			break;
+		}
+		if(key == MPI_DATATYPE_NULL)
+		{
+			if(free_entry == NULL)
+				free_entry = entry;
+			break;
+		}
+		// Slots of freed datatypes can be reused
+		if(state == CACHE_INVALID && free_entry == NULL)
+			free_entry = entry;
+		h = (h + 1) & (TYPE_CACHE_SIZE - 1);
+	}
+
+	// Derived datatypes can be larger than 2 GiB
+	PMPI_Type_size_x(type, &size);
+	if(free_entry != NULL && claim_slot(&free_entry->state))
+	{
+		__atomic_store_n(&free_entry->type, type, __ATOMIC_RELEASE);
+		free_entry->size = size;
+		__atomic_store_n(&free_entry->state, CACHE_VALID, __ATOMIC_RELEASE);
+
+		// Predefined datatypes are never freed
+		PMPI_Type_get_envelope(type, &num_int, &num_addr, &num_dt, &combiner);
+		if(combiner != MPI_COMBINER_NAMED)
+			PMPI_Type_set_attr(type, type_keyval, free_entry);
+	}
+	return size;
+}
+
+HIDDEN void init_mpi_cache()
+{
+	int i;
+
+	for(i = 0; i < COMM_CACHE_SIZE; i++)
+	{
+		comm_cache[i].comm = MPI_COMM_NULL;
+		comm_cache[i].state = CACHE_INVALID;
+		comm_cache[i].world_ranks = NULL;
+	}
+	for(i = 0; i < TYPE_CACHE_SIZE; i++)
+	{
+		type_cache[i].type = MPI_DATATYPE_NULL;
+		type_cache[i].state = CACHE_INVALID;
+	}
+
+	PMPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, comm_cache_delete, &comm_keyval, NULL);
+	PMPI_Type_create_keyval(MPI_TYPE_NULL_COPY_FN, type_cache_delete, &type_keyval, NULL);
+}
+
+HIDDEN void finalize_mpi_cache()
+{
+	int i;
+
+	for(i = 0; i < COMM_CACHE_SIZE; i++)
+	{
+		comm_cache[i].state = CACHE_INVALID;
+		free(comm_cache[i].world_ranks);
+		comm_cache[i].world_ranks = NULL;
+	}
+	for(i = 0; i < TYPE_CACHE_SIZE; i++)
+		type_cache[i].state = CACHE_INVALID;
+
+	PMPI_Comm_free_keyval(&comm_keyval);
+	PMPI_Type_free_keyval(&type_keyval);
+}
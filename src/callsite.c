@@ -0,0 +1,527 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+// Lock-free open-addressing table of the call sites of this rank. A slot is
+// claimed by a CAS on its key and never released until finalize.
+static CNTD_CallSite_t *callsite_table = NULL;
+static uint64_t callsite_dropped = 0;
+
+static inline unsigned int hash_callsite(uint64_t key)
+{
+	return (unsigned int) ((key * 0x9E3779B97F4A7C15ULL) >> 32) & (CALLSITE_TABLE_SIZE - 1);
+}
+
+// FNV-1a hash of the module path, used to match modules across ranks
+static uint64_t hash_module(const char *str)
+{
+	uint64_t h = 0xCBF29CE484222325ULL;
+
+	while(*str)
+	{
+		h ^= (unsigned char) *str++;
+		h *= 0x100000001B3ULL;
+	}
+	return h;
+}
+
+static void get_module_path(struct link_map *map, char *path, int size)
+{
+	ssize_t len;
+
+	// The main executable has an empty name in the link map
+	if(map->l_name == NULL || map->l_name[0] == '\0')
+	{
+		len = readlink("/proc/self/exe", path, size - 1);
+		if(len < 0)
+			len = 0;
+		path[len] = '\0';
+	}
+	else
+		snprintf(path, size, "%s", map->l_name);
+}
+
+HIDDEN CNTD_CallSite_t* get_callsite(MPI_Type_t mpi_type, void *addr)
+{
+	int i;
+	uint64_t curr_key;
+	uint64_t key = ((uint64_t) mpi_type << CALLSITE_TYPE_SHIFT) | ((uintptr_t) addr & CALLSITE_ADDR_MASK);
+	unsigned int h = hash_callsite(key);
+
+	for(i = 0; i < CALLSITE_TABLE_SIZE; i++)
+	{
+		CNTD_CallSite_t *site = &callsite_table[h];
+
+		curr_key = __atomic_load_n(&site->key, __ATOMIC_ACQUIRE);
+		if(curr_key == key)
+			return site;
+		if(curr_key == 0)
+		{
+			if(__atomic_compare_exchange_n(&site->key, &curr_key, key,
+				FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+				return site;
+			if(curr_key == key)
+				return site;
+		}
+		h = (h + 1) & (CALLSITE_TABLE_SIZE - 1);
+	}
+
+	return NULL;
+}
+
+// Classify the next call of the site against the EAM timeout. The confidence
+// counts the consecutive calls whose class matched the EWMA prediction.
+HIDDEN int predict_callsite(CNTD_CallSite_t *site, uint64_t timeout_ticks)
+{
+	if(site == NULL ||
+		__atomic_load_n(&site->confidence, __ATOMIC_RELAXED) < EAM_PREDICT_CONFIDENCE)
+		return EAM_PREDICT_NONE;
+
+	if(__atomic_load_n(&site->ewma_ticks, __ATOMIC_RELAXED) > timeout_ticks)
+		return EAM_PREDICT_LONG;
+	else
+		return EAM_PREDICT_SHORT;
+}
+
+static void update_prediction(CNTD_CallSite_t *site, uint64_t mpi_ticks)
+{
+	uint64_t ewma = __atomic_load_n(&site->ewma_ticks, __ATOMIC_RELAXED);
+	int confidence = __atomic_load_n(&site->confidence, __ATOMIC_RELAXED);
+	uint64_t timeout_ticks = get_eam_timeout_ticks(site->key >> CALLSITE_TYPE_SHIFT);
+	int predicted_long = ewma > timeout_ticks;
+	int actual_long = mpi_ticks > timeout_ticks;
+
+	// Seed on the first call seen, which under sampled accounting is not
+	// necessarily the first one counted
+	if(ewma == 0)
+		ewma = mpi_ticks;
+	else if(mpi_ticks > ewma)
+		ewma += (mpi_ticks - ewma) >> EAM_PREDICT_EWMA_SHIFT;
+	else
+		ewma -= (ewma - mpi_ticks) >> EAM_PREDICT_EWMA_SHIFT;
+
+	if(predicted_long == actual_long)
+	{
+		if(confidence < EAM_PREDICT_MAX_CONFIDENCE)
+			confidence++;
+	}
+	else
+		confidence = 0;
+
+	// Races between threads only lose an update of the history
+	__atomic_store_n(&site->ewma_ticks, ewma, __ATOMIC_RELAXED);
+	__atomic_store_n(&site->confidence, confidence, __ATOMIC_RELAXED);
+}
+
+HIDDEN void callsite_start(MPI_Type_t mpi_type, void *addr)
+{
+	cntd_thread.curr_site = get_callsite(mpi_type, addr);
+}
+
+HIDDEN void callsite_end(uint64_t mpi_ticks, int eam_flag)
+{
+	uint64_t curr;
+	CNTD_CallSite_t *site = cntd_thread.curr_site;
+
+	uint64_t weight = cntd_thread.weight;
+
+	if(site == NULL)
+	{
+		__atomic_fetch_add(&callsite_dropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
+
+	// Calls left out by the sampled accounting only train the predictor
+	if(weight == 0)
+	{
+		if(cntd->enable_eam_predict)
+			update_prediction(site, mpi_ticks);
+		cntd_thread.curr_site = NULL;
+		return;
+	}
+
+	__atomic_fetch_add(&site->cnt, weight, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&site->ticks, mpi_ticks * weight, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&site->data, cntd_thread.call_data * weight, __ATOMIC_RELAXED);
+	if(eam_flag)
+		__atomic_fetch_add(&site->eam_cnt, weight, __ATOMIC_RELAXED);
+
+	// A zero minimum marks a slot that has not been updated yet
+	curr = __atomic_load_n(&site->min_ticks, __ATOMIC_RELAXED);
+	while((curr == 0 || mpi_ticks < curr) &&
+		!__atomic_compare_exchange_n(&site->min_ticks, &curr, mpi_ticks,
+			TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+	curr = __atomic_load_n(&site->max_ticks, __ATOMIC_RELAXED);
+	while(mpi_ticks > curr &&
+		!__atomic_compare_exchange_n(&site->max_ticks, &curr, mpi_ticks,
+			TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+	if(cntd->enable_eam_predict)
+		update_prediction(site, mpi_ticks);
+
+	cntd_thread.curr_site = NULL;
+}
+
+static int compare_callsite(const void *a, const void *b)
+{
+	const CNTD_CallSiteReport_t *x = a;
+	const CNTD_CallSiteReport_t *y = b;
+
+	if(x->module != y->module)
+		return x->module < y->module ? -1 : 1;
+	if(x->offset != y->offset)
+		return x->offset < y->offset ? -1 : 1;
+	return x->mpi_type - y->mpi_type;
+}
+
+// Pack the local table as (module, offset) pairs and merge all ranks on rank 0.
+// Return the number of merged call sites on rank 0, and 0 on the other ranks.
+HIDDEN int get_callsite_report(CNTD_CallSiteReport_t **report)
+{
+	int i, j, world_size, num_local = 0, num_sites = 0;
+	int64_t num_local64, total64;
+	uint64_t dropped;
+	Dl_info info;
+	MPI_Datatype site_type;
+	struct link_map *map;
+	char path[STRING_SIZE];
+	CNTD_CallSiteReport_t *local, *global = NULL;
+	int *recvcounts = NULL, *displs = NULL;
+
+	*report = NULL;
+	PMPI_Comm_size(MPI_COMM_WORLD, &world_size);
+
+	local = (CNTD_CallSiteReport_t *) calloc(CALLSITE_TABLE_SIZE, sizeof(CNTD_CallSiteReport_t));
+	if(local == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the call-site report\n",
+			cntd->node.hostname, cntd->rank->world_rank);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	for(i = 0; i < CALLSITE_TABLE_SIZE; i++)
+	{
+		CNTD_CallSite_t *site = &callsite_table[i];
+		if(site->key == 0 || site->cnt == 0)
+			continue;
+
+		uintptr_t addr = (uintptr_t) (site->key & CALLSITE_ADDR_MASK);
+		CNTD_CallSiteReport_t *entry = &local[num_local++];
+
+		if(dladdr1((void *) addr, &info, (void **) &map, RTLD_DL_LINKMAP) && map != NULL)
+		{
+			get_module_path(map, path, STRING_SIZE);
+			entry->module = hash_module(path);
+			entry->offset = addr - map->l_addr;
+		}
+		else
+		{
+			entry->module = 0;
+			entry->offset = addr;
+		}
+		entry->mpi_type = (int) (site->key >> CALLSITE_TYPE_SHIFT);
+		entry->num_ranks = 1;
+		entry->cnt = site->cnt;
+		entry->time = ticks_to_sec(site->ticks);
+		entry->min_time = ticks_to_sec(site->min_ticks);
+		entry->max_time = ticks_to_sec(site->max_ticks);
+		entry->wait_time = ticks_to_sec(site->wait_ticks);
+		entry->data = site->data;
+		entry->eam_cnt = site->eam_cnt;
+	}
+
+	PMPI_Reduce(&callsite_dropped, &dropped, 1, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+
+	if(cntd->rank->world_rank == 0 && dropped > 0)
+		fprintf(stderr, "Warning: <COUNTDOWN-node:%s-rank:%d> Call-site table full, %lu MPI calls not attributed\n",
+			cntd->node.hostname, cntd->rank->world_rank, dropped);
+
+	// The counts and displacements are in entries, the total must fit an int
+	num_local64 = num_local;
+	PMPI_Allreduce(&num_local64, &total64, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+	if(total64 > INT_MAX)
+	{
+		if(cntd->rank->world_rank == 0)
+			fprintf(stderr, "Warning: <COUNTDOWN-node:%s-rank:%d> %ld call sites, too many to gather\n",
+				cntd->node.hostname, cntd->rank->world_rank, total64);
+		free(local);
+		return 0;
+	}
+
+	if(cntd->rank->world_rank == 0)
+	{
+		num_sites = (int) total64;
+		recvcounts = (int *) malloc(world_size * sizeof(int));
+		displs = (int *) malloc(world_size * sizeof(int));
+		global = (CNTD_CallSiteReport_t *) malloc((num_sites > 0 ? num_sites : 1) * sizeof(CNTD_CallSiteReport_t));
+		if(recvcounts == NULL || displs == NULL || global == NULL)
+		{
+			fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the call-site report\n",
+				cntd->node.hostname, cntd->rank->world_rank);
+			PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+		}
+	}
+
+	PMPI_Type_contiguous(sizeof(CNTD_CallSiteReport_t), MPI_BYTE, &site_type);
+	PMPI_Type_commit(&site_type);
+
+	PMPI_Gather(&num_local, 1, MPI_INT, recvcounts, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+	if(cntd->rank->world_rank == 0)
+	{
+		displs[0] = 0;
+		for(i = 1; i < world_size; i++)
+			displs[i] = displs[i - 1] + recvcounts[i - 1];
+	}
+
+	PMPI_Gatherv(local, num_local, site_type, global, recvcounts, displs, site_type, 0, MPI_COMM_WORLD);
+	PMPI_Type_free(&site_type);
+	free(local);
+	free(recvcounts);
+	free(displs);
+
+	if(cntd->rank->world_rank != 0)
+		return 0;
+
+	// Merge the same call site of different ranks
+	qsort(global, num_sites, sizeof(CNTD_CallSiteReport_t), compare_callsite);
+	for(i = 0, j = -1; i < num_sites; i++)
+	{
+		if(j >= 0 && compare_callsite(&global[j], &global[i]) == 0)
+		{
+			global[j].num_ranks++;
+			global[j].cnt += global[i].cnt;
+			global[j].time += global[i].time;
+			if(global[i].min_time < global[j].min_time)
+				global[j].min_time = global[i].min_time;
+			if(global[i].max_time > global[j].max_time)
+				global[j].max_time = global[i].max_time;
+			global[j].wait_time += global[i].wait_time;
+			global[j].data += global[i].data;
+			global[j].eam_cnt += global[i].eam_cnt;
+		}
+		else
+			global[++j] = global[i];
+	}
+
+	*report = global;
+	return j + 1;
+}
+
+typedef struct
+{
+	uint64_t module;
+	char path[STRING_SIZE];
+	uintptr_t bias;
+	int found;
+} CNTD_ModuleLookup_t;
+
+static int find_module(struct dl_phdr_info *info, size_t size, void *data)
+{
+	CNTD_ModuleLookup_t *lookup = data;
+	char path[STRING_SIZE];
+
+	if(info->dlpi_name == NULL || info->dlpi_name[0] == '\0')
+	{
+		ssize_t len = readlink("/proc/self/exe", path, STRING_SIZE - 1);
+		if(len < 0)
+			len = 0;
+		path[len] = '\0';
+	}
+	else
+		snprintf(path, STRING_SIZE, "%s", info->dlpi_name);
+
+	if(hash_module(path) == lookup->module)
+	{
+		snprintf(lookup->path, STRING_SIZE, "%s", path);
+		lookup->bias = info->dlpi_addr;
+		lookup->found = TRUE;
+		return 1;
+	}
+	return 0;
+}
+
+static void strip_newline(char *str)
+{
+	str[strcspn(str, "\n")] = '\0';
+}
+
+// Run addr2line on the module without a shell, the path is passed as is.
+// Return the read end of its standard output, NULL on failure.
+static FILE* spawn_addr2line(char **argv, pid_t *pid)
+{
+	int fds[2], null_fd;
+	FILE *fd;
+
+	if(pipe(fds) != 0)
+		return NULL;
+
+	*pid = fork();
+	if(*pid < 0)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		return NULL;
+	}
+	if(*pid == 0)
+	{
+		dup2(fds[1], STDOUT_FILENO);
+		null_fd = open("/dev/null", O_WRONLY);
+		if(null_fd >= 0)
+			dup2(null_fd, STDERR_FILENO);
+		close(fds[0]);
+		close(fds[1]);
+		execvp(argv[0], argv);
+		_exit(127);
+	}
+
+	close(fds[1]);
+	fd = fdopen(fds[0], "r");
+	if(fd == NULL)
+	{
+		close(fds[0]);
+		waitpid(*pid, NULL, 0);
+	}
+	return fd;
+}
+
+// Symbolize the call sites of one module with a single addr2line invocation
+static void addr2line_module(const char *path, CNTD_CallSiteReport_t *sites,
+	CNTD_CallSiteName_t *names, int first, int last)
+{
+	int i, num_args = 0;
+	char **argv, *addrs;
+	pid_t pid;
+	FILE *fd;
+
+	argv = (char **) malloc((last - first + 6) * sizeof(char *));
+	addrs = (char *) malloc((last - first) * ADDR2LINE_ADDR_SIZE);
+	if(argv == NULL || addrs == NULL)
+	{
+		free(argv);
+		free(addrs);
+		return;
+	}
+
+	argv[num_args++] = "addr2line";
+	argv[num_args++] = "-f";
+	argv[num_args++] = "-C";
+	argv[num_args++] = "-e";
+	argv[num_args++] = (char *) path;
+	// The return address points after the call instruction
+	for(i = first; i < last; i++)
+	{
+		char *addr = addrs + (i - first) * ADDR2LINE_ADDR_SIZE;
+		snprintf(addr, ADDR2LINE_ADDR_SIZE, "0x%lx", sites[i].offset - 1);
+		argv[num_args++] = addr;
+	}
+	argv[num_args] = NULL;
+
+	fd = spawn_addr2line(argv, &pid);
+	if(fd != NULL)
+	{
+		for(i = first; i < last; i++)
+		{
+			char function[STRING_SIZE], source[STRING_SIZE];
+
+			if(fgets(function, STRING_SIZE, fd) == NULL || fgets(source, STRING_SIZE, fd) == NULL)
+				break;
+			strip_newline(function);
+			strip_newline(source);
+			if(strcmp(function, "??") != 0)
+				snprintf(names[i].function, STRING_SIZE, "%s", function);
+			if(strncmp(source, "??", 2) != 0)
+				snprintf(names[i].source, STRING_SIZE, "%s", source);
+		}
+		fclose(fd);
+		waitpid(pid, NULL, 0);
+	}
+
+	free(argv);
+	free(addrs);
+}
+
+// Resolve the merged call sites against the modules loaded by this process.
+// The sites must be sorted by module as returned by get_callsite_report.
+HIDDEN void resolve_callsites(CNTD_CallSiteReport_t *sites, int num_sites, CNTD_CallSiteName_t *names)
+{
+	int i, first;
+	Dl_info info;
+	CNTD_ModuleLookup_t lookup;
+
+	for(i = 0; i < num_sites; i++)
+	{
+		snprintf(names[i].module, STRING_SIZE, "%016lx", sites[i].module);
+		snprintf(names[i].function, STRING_SIZE, "??");
+		snprintf(names[i].source, STRING_SIZE, "??");
+	}
+
+	for(first = 0; first < num_sites; first = i)
+	{
+		for(i = first; i < num_sites && sites[i].module == sites[first].module; i++);
+
+		lookup.module = sites[first].module;
+		lookup.found = FALSE;
+		dl_iterate_phdr(find_module, &lookup);
+		if(!lookup.found)
+			continue;
+
+		int j;
+		for(j = first; j < i; j++)
+		{
+			snprintf(names[j].module, STRING_SIZE, "%s", lookup.path);
+			if(dladdr((void *) (lookup.bias + sites[j].offset - 1), &info) && info.dli_sname != NULL)
+				snprintf(names[j].function, STRING_SIZE, "%s", info.dli_sname);
+		}
+
+		addr2line_module(lookup.path, sites, names, first, i);
+	}
+}
+
+HIDDEN void init_callsite()
+{
+	callsite_table = (CNTD_CallSite_t *) calloc(CALLSITE_TABLE_SIZE, sizeof(CNTD_CallSite_t));
+	if(callsite_table == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the call-site table\n",
+			cntd->node.hostname, cntd->rank->world_rank);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+	callsite_dropped = 0;
+	cntd_thread.curr_site = NULL;
+}
+
+HIDDEN void finalize_callsite()
+{
+	free(callsite_table);
+	callsite_table = NULL;
+}
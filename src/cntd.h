@@ -37,9 +37,13 @@
 #include <unistd.h>
 #include <sched.h>
 #include <signal.h>
+#include <pthread.h>
 #include <stdint.h>
+#include <limits.h>
 #include <string.h>
 #include <fcntl.h>
+#include <dlfcn.h>
+#include <link.h>
 #include <errno.h>
 #include <sys/resource.h>
 #include <sys/mman.h>
@@ -47,9 +51,15 @@
 #include <sys/time.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <sys/ioctl.h>
 #include <asm/unistd.h>
 #include <linux/perf_event.h>
+#include <linux/futex.h>
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#include <cpuid.h>
+#endif
 
 // MPI
 #include <mpi.h>
@@ -78,6 +88,21 @@
 // CNTD MPI Definitions
 #include "cntd_mpi_def.h"
 
+// Energy-aware MPI policy interface
+#include "cntd_policy.h"
+
+// MPI-4 persistent collectives and partitioned communication, already
+// provided by Open MPI 5 that still reports MPI 3.1
+#if MPI_VERSION >= 4 || (defined(OMPI_MAJOR_VERSION) && OMPI_MAJOR_VERSION >= 5)
+#define HAVE_MPI4_PERSISTENT
+#endif
+
+// Fortran ABIs intercepted by the Fortran wrappers: Open MPI and the MPICH
+// derived MPIs (MPICH, Intel MPI, Cray MPICH, MVAPICH)
+#if defined(OMPI_MPI_H) || defined(MPICH_VERSION) || defined(MPICH2_VERSION) || defined(I_MPI_VERSION)
+#define HAVE_FORTRAN_ABI
+#endif
+
 
 #ifndef __CNTD_H__
 #define	__CNTD_H__
@@ -88,9 +113,80 @@
 #define MAX_NUM_SOCKETS 				16		// Max supported sockets in a single node
 #define MAX_NUM_GPUS 					16		// Max supported gpus in a single node
 #define MAX_NUM_CPUS					1024	// Max supported CPUS in a single node
+#define MAX_NUM_THREADS					256		// Max threads of a rank calling MPI at the same time
+#define THREAD_FOLD_TIME				0.001	// 1ms, period of the fold of the thread counters
 
 // EAM configurations
 #define DEFAULT_TIMEOUT 				0.0005	// 500us
+#define DEFAULT_POLL_GAP				0.00002	// 20us
+#define DEFAULT_ADAPTIVE_PENALTY		5		// 5% of the calls
+#define DEFAULT_POWER_CAP_THRESHOLD		100		// 100% of the ranks of the socket
+#define DEFAULT_POWER_CAP_HOLD			0.01	// 10ms
+#define DEFAULT_IMBALANCE_PERIOD		50		// 50 collectives on MPI_COMM_WORLD
+#define DEFAULT_IMBALANCE_GUARD			5		// 5% of the compute time
+#define MIN_ADAPTIVE_TIMEOUT			0.00002	// 20us
+#define MAX_LADDER_STEPS				8		// Max steps of the p-state ladder
+
+// Calibration of the tick counter against CLOCK_MONOTONIC
+#define TICKS_CALIBRATION_TIME			0.02	// 20ms
+
+// Handle caches (power of 2)
+#define COMM_CACHE_SIZE					256
+#define TYPE_CACHE_SIZE					1024
+
+// Call-site table (power of 2)
+#define CALLSITE_TABLE_SIZE				4096
+#define CALLSITE_ADDR_MASK				0xFFFFFFFFFFFFULL
+#define CALLSITE_TYPE_SHIFT				48
+#define ADDR2LINE_ADDR_SIZE				24
+
+// Log2 message-size histograms: bin 0 holds empty messages, bin b the
+// sizes in [2^(b-1), 2^b) and the last bin all the larger ones
+#define NUM_MSG_SIZE_BINS				34
+
+// Table of the pending nonblocking requests (power of 2)
+#define REQUEST_TABLE_SIZE				4096
+#define REQUEST_MAX_PROBE				64
+#define REQUEST_TOMBSTONE				UINTPTR_MAX
+#define REQUEST_PENDING_SIZE			16		// Origins of the requests completed by one call
+
+// Sparse communication matrix: peer table of each rank (power of 2, sized
+// on the world size) and table of the communicators used by collectives
+#define MATRIX_MIN_TABLE_SIZE			16
+#define MATRIX_MAX_TABLE_SIZE			65536
+#define MATRIX_COMM_TABLE_SIZE			256
+#define MATRIX_MAGIC					"CNTDCOO1"
+#define MATRIX_HEADER_SIZE				24		// Magic, world size, entry size and nonzeros
+#define MATRIX_CSV_LINE_SIZE			80
+#define MATRIX_WRITE_CHUNK				(1 << 30)	// Bytes per rank of one collective write
+
+// Call-site duration predictor of EAM
+#define EAM_PREDICT_EWMA_SHIFT			3		// EWMA weight of the last call (1/8)
+#define EAM_PREDICT_MAX_CONFIDENCE		7
+#define EAM_PREDICT_CONFIDENCE			4		// Min confidence to trust the prediction
+#define EAM_PREDICT_NONE				0
+#define EAM_PREDICT_SHORT				1
+#define EAM_PREDICT_LONG				2
+
+// Adaptive EAM timeout: log-linear duration histogram of every MPI type, bin 0
+// holds the durations below 2^TIMEOUT_MIN_SHIFT ticks and every power of 2
+// above is split in 2^TIMEOUT_SUB_SHIFT bins. The timeout of the type is
+// chosen again every TIMEOUT_UPDATE_PERIOD calls of the type.
+#define TIMEOUT_MIN_SHIFT				10
+#define TIMEOUT_SUB_SHIFT				2
+#define NUM_TIMEOUT_BINS				128
+#define TIMEOUT_UPDATE_PERIOD			256
+#define EAM_TIMEOUT_NEVER				UINT64_MAX	// No timeout armed for the type
+
+// Statistics of the adaptive timeouts of every MPI type for the EAM report
+#define TIMEOUT_STAT_UPDATES			0
+#define TIMEOUT_STAT_DISABLED			1
+#define TIMEOUT_STAT_SUM				2
+#define TIMEOUT_STAT_LAST				3
+#define TIMEOUT_STAT_LAST_CNT			4
+#define TIMEOUT_STAT_MIN				5
+#define TIMEOUT_STAT_MAX				6
+#define NUM_TIMEOUT_STATS				7
 
 #define MEM_SIZE 						1024
 #define STRING_SIZE 					1024
@@ -102,13 +198,54 @@
 #define RANK_MPI_REPORT_FILE			"cntd_rank_mpi.csv"
 #define EAM_REPORT_FILE					"cntd_eam.csv"
 #define EAM_SLACK_REPORT_FILE			"cntd_eam_slack.csv"
+#define CALLSITE_REPORT_FILE			"cntd_callsite.csv"
+#define REQUEST_REPORT_FILE				"cntd_request.csv"
+#define MSG_SIZE_REPORT_FILE			"cntd_msg_size.csv"
+#define LADDER_REPORT_FILE				"cntd_ladder.csv"
+#define MATRIX_REPORT_FILE				"cntd_comm_matrix.bin"
+#define MATRIX_CSV_REPORT_FILE			"cntd_comm_matrix.csv"
+#define MATRIX_COLL_REPORT_FILE			"cntd_comm_collective.csv"
 #define TMP_TIME_SERIES_FILE			"%s/cntd_%s.%s.csv"
 #define TIME_SERIES_FILE				"%s/cntd_%s.csv"
 #define SHM_FILE						"/cntd_local_rank_%d.%s"
 
+// MPI classes of instrumentation
+#define MPI_CLASS_COLLECTIVE			0
+#define MPI_CLASS_P2P					1
+#define MPI_CLASS_WAIT					2
+#define MPI_CLASS_RMA					3
+#define MPI_CLASS_IO					4
+#define MPI_CLASS_ACCESSORY				5
+#define MPI_CLASS_POLLING				6
+#define NUM_MPI_CLASS					7
+#define MPI_CLASS_ALL					((1 << NUM_MPI_CLASS) - 1)
+
+// Prologue and epilogue of a wrapper, specialized at compile time on the MPI
+// class of the call (low byte) and on the hooks the class needs
+#define CALL_EAM						(1 << 8)	// Energy-aware policy on the call
+#define CALL_COLL						(1 << 9)	// Collective in the communication matrix
+#define CALL_CLASS(flags)				((flags) & 0xff)
+#define CALL_COLLECTIVE					(MPI_CLASS_COLLECTIVE | CALL_EAM | CALL_COLL)
+#define CALL_P2P						(MPI_CLASS_P2P | CALL_EAM)
+#define CALL_WAIT						(MPI_CLASS_WAIT | CALL_EAM)
+#define CALL_RMA						(MPI_CLASS_RMA | CALL_EAM)
+#define CALL_IO							(MPI_CLASS_IO | CALL_EAM)
+#define CALL_ACCESSORY					(MPI_CLASS_ACCESSORY)
+#define CALL_POLLING					(MPI_CLASS_POLLING | CALL_EAM)
+
+__attribute__((unused)) static const char *mpi_class_str[] = {
+	"collective", "p2p", "wait", "rma", "io", "accessory", "polling"
+};
+
 // Hide symbols for external linking
 #define HIDDEN  __attribute__((visibility("hidden")))
 
+// Thread-local storage, the library is loaded at startup
+#define THREAD_LOCAL					__thread __attribute__((tls_model("initial-exec")))
+
+// Return address of the intercepted MPI call into the application
+#define CALLER_ADDR						__builtin_return_address(0)
+
 // Constants
 #define CNTD_MPI_TAG 					666
 
@@ -210,6 +347,7 @@
 #define INTEL_RAPL_PKG_NAME 			"/sys/devices/virtual/powercap/intel-rapl/intel-rapl:%u/name"
 #define PKG_ENERGY_UJ 					"/sys/devices/virtual/powercap/intel-rapl/intel-rapl:%u/energy_uj"
 #define PKG_MAX_ENERGY_RANGE_UJ 		"/sys/devices/virtual/powercap/intel-rapl/intel-rapl:%u/max_energy_range_uj"
+#define PKG_POWER_LIMIT_UW				"/sys/devices/virtual/powercap/intel-rapl/intel-rapl:%u/constraint_0_power_limit_uw"
 
 #define INTEL_RAPL_DRAM 				"/sys/devices/virtual/powercap/intel-rapl/intel-rapl:%u/intel-rapl:%u:%u"
 #define INTEL_RAPL_DRAM_NAME 			"/sys/devices/virtual/powercap/intel-rapl/intel-rapl:%u/intel-rapl:%u:%u/name"
@@ -233,6 +371,9 @@
 // Intel frequency knob
 #define IA32_PERF_CTL 					(0x199)
 #define MSR_TURBO_RATIO_LIMIT			(0x1AD)
+// Intel uncore frequency knobs
+#define MSR_UNCORE_RATIO_LIMIT			(0x620)
+#define UNCORE_MAX_FREQ_KHZ				"/sys/devices/system/cpu/intel_uncore_frequency/package_%02d_die_00/max_freq_khz"
 
 #elif POWER9
 
@@ -433,6 +574,16 @@ typedef struct
 	double app_time[2];
 	double mpi_time[2];
 
+	// Tick counters, converted to seconds at the end of the execution
+	double tick_freq;
+	uint64_t app_ticks;
+	uint64_t mpi_ticks;
+	uint64_t mpi_type_ticks[NUM_MPI_TYPE];
+	uint64_t cntd_mpi_type_ticks[NUM_MPI_TYPE];
+	uint64_t overhead_ticks[NUM_MPI_CLASS];
+	uint64_t sampling_overhead_ticks;
+	double sampled_var_ticks[NUM_MPI_CLASS];
+
 	long max_mem_usage;
 	uint64_t mpi_net_data[2][2];
 	uint64_t mpi_file_data[2][2];
@@ -445,6 +596,24 @@ typedef struct
 
 	uint64_t cntd_mpi_type_cnt[NUM_MPI_TYPE];
 	double cntd_mpi_type_time[NUM_MPI_TYPE];
+
+	// Time spent by COUNTDOWN itself
+	double overhead_time[NUM_MPI_CLASS];
+	double sampling_overhead_time;
+
+	// Variance of the estimated MPI time and bytes under sampled accounting
+	double sampled_var_time[NUM_MPI_CLASS];
+	double sampled_var_data[NUM_MPI_CLASS];
+
+	// Time the rank entered MPI, zero outside, watched by the power cap
+	// controller of the local master
+	int socket_id;
+	uint64_t mpi_entry_ticks;
+
+	// Uncore coordination of the sockets, only the segment of the local
+	// master is used: spinlock and ranks waiting in MPI of every socket
+	int uncore_lock[MAX_NUM_SOCKETS];
+	int uncore_waiting[MAX_NUM_SOCKETS];
 } CNTD_RankInfo_t;
 
 typedef struct
@@ -476,16 +645,192 @@ typedef struct
 	double energy_gpu[MAX_NUM_SOCKETS];		// Joules - counter - only for Power9
 } CNTD_NodeInfo_t;
 
+// Call-site statistics, keyed on (MPI type << 48 | return address)
+typedef struct
+{
+	uint64_t key;
+	uint64_t cnt;
+	uint64_t ticks;
+	uint64_t min_ticks;
+	uint64_t max_ticks;
+	uint64_t data;
+	uint64_t eam_cnt;
+	uint64_t wait_ticks;
+
+	// Duration history for the EAM predictor
+	uint64_t ewma_ticks;
+	int confidence;
+} CNTD_CallSite_t;
+
+// Call-site statistics resolved to module and offset for the final report
+typedef struct
+{
+	uint64_t module;
+	uint64_t offset;
+	int mpi_type;
+	int num_ranks;
+	uint64_t cnt;
+	double time;
+	double min_time;
+	double max_time;
+	double wait_time;
+	uint64_t data;
+	uint64_t eam_cnt;
+} CNTD_CallSiteReport_t;
+
+typedef struct
+{
+	char module[STRING_SIZE];
+	char function[STRING_SIZE];
+	char source[STRING_SIZE];
+} CNTD_CallSiteName_t;
+
+// Pending nonblocking request, keyed on the request handle
+typedef struct
+{
+	uintptr_t request;
+	MPI_Type_t mpi_type;
+	int peer;
+	int world_peer;
+	int persistent;
+	uint64_t data;
+	uint64_t post_ticks;
+	CNTD_CallSite_t *site;
+	// Bytes sent and received by every start of a persistent request
+	uint64_t start_data[2];
+} CNTD_Request_t;
+
+// Traffic toward one peer (keyed on its world rank + 1) or on one
+// communicator used by collectives (keyed on the hash of its group, with the
+// world rank of its rank 0 and its size)
+typedef struct
+{
+	uint64_t key;
+	uint64_t bytes;
+	uint64_t cnt;
+	int32_t leader;
+	uint32_t size;
+} CNTD_MatrixCounter_t;
+
+// Nonzero of the communication matrix as written in the binary report
+typedef struct
+{
+	int32_t src;
+	int32_t dst;
+	uint64_t bytes;
+	uint64_t msgs;
+} CNTD_MatrixEntry_t;
+
+// Origin of the requests completed by the current MPI call
+typedef struct
+{
+	MPI_Type_t mpi_type;
+	CNTD_CallSite_t *site;
+	unsigned int cnt;
+} CNTD_RequestOrigin_t;
+
+// States of a polling episode besides FALSE and TRUE, and end of the last
+// test while the thread is inside one
+#define POLL_EXPIRING					2
+#define POLL_EXPIRED					3
+#define POLL_IN_CALL					UINT64_MAX
+
+// Counters of the MPI calls of a thread under MPI_THREAD_MULTIPLE, same
+// layout as in the rank record. The thread folds them into the record every
+// THREAD_FOLD_TIME and when it exits, only the MPI types marked in dirty.
+typedef struct
+{
+	uint64_t app_ticks;
+	uint64_t mpi_ticks;
+	uint64_t mpi_type_ticks[NUM_MPI_TYPE];
+	uint64_t mpi_type_cnt[NUM_MPI_TYPE];
+	uint64_t cntd_mpi_type_ticks[NUM_MPI_TYPE];
+	uint64_t cntd_mpi_type_cnt[NUM_MPI_TYPE];
+	uint64_t mpi_type_data[2][NUM_MPI_TYPE];
+	uint64_t overhead_ticks[NUM_MPI_CLASS];
+	double sampled_var_ticks[NUM_MPI_CLASS];
+	double sampled_var_data[NUM_MPI_CLASS];
+	uint64_t mpi_net_data[2][2];
+	uint64_t mpi_file_data[2][2];
+	uint64_t dirty[(NUM_MPI_TYPE + 63) / 64];
+	uint64_t fold_ticks;
+} CNTD_ThreadCounters_t;
+
+// Slot of a thread calling MPI in the registry of the rank, kept when the
+// thread exits, with the counters of the thread. The polling episode of the thread is published here: the
+// timer callback expires it once the thread has been computing for longer
+// than the gap since the end of its last test (poll_last).
+typedef struct
+{
+	int used;
+	int poll_active;
+	int poll_restored;
+	uint64_t poll_last;
+	uint64_t poll_epoch;
+	CNTD_ThreadCounters_t *counters;
+} CNTD_ThreadSlot_t;
+
+// Per-thread state of the current MPI call
+typedef struct
+{
+	uint64_t ticks[2];
+	CNTD_CallSite_t *curr_site;
+	uint64_t call_data;
+	uint64_t overhead_ticks;
+	int registered;
+
+	// Set while a Fortran wrapper calls its PMPI binding: the C wrappers
+	// forward to PMPI so that MPIs implementing Fortran on top of C MPI_
+	// functions do not account the call twice
+	int fortran_nested;
+
+	// Sampled accounting: weight of the current call (0 when not accounted),
+	// calls to skip per MPI class and random generator state
+	uint32_t weight;
+	uint32_t account_skip[NUM_MPI_CLASS];
+	uint64_t account_seed;
+
+	// Registry slot of the thread
+	CNTD_ThreadSlot_t *slot;
+
+	// Outcome of the last polling call and current polling episode
+	int poll_done;
+	void *poll_site;
+	uint64_t poll_ticks;
+
+	// Requests completed by the current MPI call
+	CNTD_RequestOrigin_t completed[REQUEST_PENDING_SIZE];
+	int num_completed;
+	MPI_Request *saved_requests;
+	int saved_size;
+} CNTD_Thread_t;
+
 // Global variables
 typedef struct
 {
 	// User-defined values
 	double eam_timeout;
+	uint64_t eam_timeout_ticks;
+	unsigned int adaptive_penalty;
+	int num_ladder_steps;
+	double ladder_time[MAX_LADDER_STEPS];
+	uint64_t ladder_ticks[MAX_LADDER_STEPS];
+	int ladder_pstate[MAX_LADDER_STEPS];
+	int uncore_pstate;
+	unsigned int power_cap;
+	unsigned int power_cap_threshold;
+	double power_cap_hold;
+	uint64_t power_cap_hold_ticks;
+	unsigned int imbalance_period;
+	unsigned int imbalance_guard;
+	double poll_gap;
+	uint64_t poll_gap_ticks;
 	int sys_pstate[2];
 	int user_pstate[2];
 	double sampling_time;
 	char log_dir[STRING_SIZE];
 	char tmp_dir[STRING_SIZE];
+	char policy_name[STRING_SIZE];
 
 	unsigned int force_msr:1;
 	unsigned int enable_cntd:1;
@@ -495,12 +840,42 @@ typedef struct
 	unsigned int enable_timeseries_report:1;
 	unsigned int enable_report:1;
 	unsigned int enable_perf:1;
+	unsigned int enable_watchdog:1;
+	unsigned int enable_tsc:1;
+	unsigned int enable_callsite:1;
+	unsigned int enable_eam_predict:1;
+	unsigned int enable_adaptive_timeout:1;
+	unsigned int enable_uncore:1;
+	unsigned int enable_power_cap:1;
+	unsigned int enable_imbalance:1;
+	unsigned int enable_request:1;
+	unsigned int enable_poll:1;
+	unsigned int enable_matrix:1;
+	unsigned int enable_matrix_csv:1;
+	unsigned int enable_sampled_accounting:1;
+	unsigned int enable_sampled_random:1;
+	int instrument_mask;
+	uint32_t account_rate[NUM_MPI_CLASS];
+
+	// Energy-aware MPI policy, called by every instrumented MPI call
+	CNTD_Policy_t policy;
 
 	MPI_Comm comm_local;
 	MPI_Comm comm_local_masters;
 	int local_rank_size;
 
-	unsigned int into_mpi:1;
+	// Threads of the rank calling MPI, those currently inside MPI and those
+	// with an open polling episode
+	unsigned int thread_multiple:1;
+	pthread_key_t thread_key;
+	int num_threads;
+	int threads_in_mpi;
+	int threads_polling;
+	CNTD_ThreadSlot_t threads[MAX_NUM_THREADS];
+	uint64_t thread_fold_ticks;
+
+	// Last entry and exit of MPI of the rank, single-threaded only
+	uint64_t mpi_ticks_last[2];
 
 	// Runtime values
 	timer_t timer;
@@ -533,9 +908,162 @@ typedef struct
 } CNTD_t;
 
 extern CNTD_t *cntd;
+extern HIDDEN THREAD_LOCAL CNTD_Thread_t cntd_thread;
 
 extern _Bool hwp_usage;
 
+// Per MPI type instrumentation table (one byte checked by every wrapper)
+extern HIDDEN uint8_t mpi_type_instr[NUM_MPI_TYPE];
+extern HIDDEN uint8_t mpi_type_class[NUM_MPI_TYPE];
+
+// Sampled accounting: 1 out of mpi_type_rate calls of each MPI type is accounted
+extern HIDDEN uint32_t mpi_type_rate[NUM_MPI_TYPE];
+
+// EAM timeout of every MPI type, all equal to CNTD_TIMEOUT unless adaptive
+extern HIDDEN uint64_t mpi_type_timeout_ticks[NUM_MPI_TYPE];
+
+// Calls of every MPI type that reached a step of the p-state ladder and ticks
+// spent at the step
+extern HIDDEN uint64_t mpi_type_ladder_cnt[NUM_MPI_TYPE][MAX_LADDER_STEPS];
+extern HIDDEN uint64_t mpi_type_ladder_ticks[NUM_MPI_TYPE][MAX_LADDER_STEPS];
+
+// Compute p-state of the rank under load-imbalance-driven DVFS, NO_CONF at
+// the maximum p-state
+extern HIDDEN int imbalance_pstate;
+
+// Message-size histograms per direction and MPI type
+extern HIDDEN uint64_t mpi_type_msg_size[2][NUM_MPI_TYPE][NUM_MSG_SIZE_BINS];
+
+// Tick counter: invariant TSC, CNTVCT or timebase when available,
+// otherwise nanoseconds of CLOCK_MONOTONIC
+extern HIDDEN _Bool tsc_usage;
+extern HIDDEN double tick_freq;
+
+static inline uint64_t read_ticks()
+{
+	if(tsc_usage)
+	{
+#if defined(__x86_64__)
+		return __rdtsc();
+#elif defined(__aarch64__)
+		uint64_t ticks;
+		__asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (ticks));
+		return ticks;
+#elif defined(__powerpc64__)
+		return __builtin_ppc_get_timebase();
+#endif
+	}
+
+	struct timespec sample;
+	clock_gettime(CLOCK_MONOTONIC, &sample);
+	return (uint64_t) sample.tv_sec * 1000000000ULL + (uint64_t) sample.tv_nsec;
+}
+
+// Hint to the CPU inside a spin-wait loop
+static inline void cpu_relax()
+{
+#if defined(__x86_64__)
+	_mm_pause();
+#elif defined(__aarch64__)
+	__asm__ __volatile__("yield" ::: "memory");
+#elif defined(__powerpc64__)
+	__asm__ __volatile__("or 27,27,27" ::: "memory");
+#endif
+}
+
+static inline double ticks_to_sec(uint64_t ticks)
+{
+	return (double) ticks / tick_freq;
+}
+
+// Set by the polling wrappers (Test*, Iprobe, ...) before call_end
+static inline void set_poll_result(int done)
+{
+	cntd_thread.poll_done = done;
+}
+
+// Counter of the rank updated by every MPI call: the one of the thread
+// under MPI_THREAD_MULTIPLE, folded by fold_thread_counters
+#define CALL_COUNTER(field) (*(cntd->thread_multiple ? \
+	&cntd_thread.slot->counters->field : &cntd->rank->field))
+
+// Mark the per-type counters of the thread to fold
+static inline void touch_call_counters(MPI_Type_t mpi_type)
+{
+	if(cntd->thread_multiple)
+		cntd_thread.slot->counters->dirty[mpi_type / 64] |= 1ULL << (mpi_type % 64);
+}
+
+// The counters of the rank are shared by all its threads under MPI_THREAD_MULTIPLE
+static inline void add_counter(uint64_t *counter, uint64_t value)
+{
+	if(cntd->thread_multiple)
+		__atomic_fetch_add(counter, value, __ATOMIC_RELAXED);
+	else
+		*counter += value;
+}
+
+static inline void add_double_counter(double *counter, double value)
+{
+	if(cntd->thread_multiple)
+	{
+		double curr;
+		__atomic_load(counter, &curr, __ATOMIC_RELAXED);
+		while(!__atomic_compare_exchange(counter, &curr, &(double){curr + value},
+			TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+	}
+	else
+		*counter += value;
+}
+
+// Weight of the accounting of the next call of the MPI type: the rate for a
+// sampled call, 0 for a call that only runs the energy-aware policies.
+// Strided sampling takes every rate-th call of the class, random sampling
+// skips a uniform number of calls with mean rate-1.
+static inline uint32_t get_account_weight(MPI_Type_t mpi_type)
+{
+	uint32_t rate = mpi_type_rate[mpi_type];
+	uint32_t *skip;
+
+	if(rate <= 1)
+		return 1;
+
+	skip = &cntd_thread.account_skip[mpi_type_class[mpi_type]];
+	if(*skip > 0)
+	{
+		(*skip)--;
+		return 0;
+	}
+
+	if(cntd->enable_sampled_random)
+	{
+		uint64_t x = cntd_thread.account_seed;
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		cntd_thread.account_seed = x;
+		*skip = (uint32_t) (x % (2 * (uint64_t) rate - 1));
+	}
+	else
+		*skip = rate - 1;
+	return rate;
+}
+
+// EAM_TIMEOUT_NEVER when no adaptive timeout meets the transition bound
+static inline uint64_t get_eam_timeout_ticks(MPI_Type_t mpi_type)
+{
+	return __atomic_load_n(&mpi_type_timeout_ticks[mpi_type], __ATOMIC_RELAXED);
+}
+
+static inline void add_msg_size(int dir, MPI_Type_t mpi_type, uint64_t size, uint64_t num)
+{
+	unsigned int bin = (size == 0) ? 0 : 64 - __builtin_clzll(size);
+
+	if(bin >= NUM_MSG_SIZE_BINS)
+		bin = NUM_MSG_SIZE_BINS - 1;
+	add_counter(&mpi_type_msg_size[dir][mpi_type][bin], num);
+}
+
 #ifdef MOSQUITTO_ENABLED
 typedef struct mosquitto MOSQUITTO_t;
 
@@ -562,28 +1090,86 @@ void init_perf();
 void finalize_perf();
 void init_arch_conf();
 
+// imbalance.c
+void imbalance_end(MPI_Type_t mpi_type, MPI_Comm comm);
+void init_imbalance();
+void finalize_imbalance();
+
 // init.c
 void start_cntd();
 void stop_cntd();
-void call_start(MPI_Type_t mpi_type, MPI_Comm comm, int addr);
-void call_end(MPI_Type_t mpi_type, MPI_Comm comm, int addr);
+void register_thread();
+
+// cache.c
+int get_comm_size(MPI_Comm comm);
+int is_comm_world(MPI_Comm comm);
+int get_world_rank(MPI_Comm comm, int rank);
+uint64_t get_comm_group_id(MPI_Comm comm);
+MPI_Count get_type_size(MPI_Datatype type);
+void init_mpi_cache();
+void finalize_mpi_cache();
+
+// matrix.c
+void add_matrix_p2p(MPI_Comm comm, int dest, uint64_t data);
+void add_matrix_peer(int peer, uint64_t data);
+void add_matrix_coll(MPI_Comm comm, uint64_t data);
+void print_matrix_report();
+void init_matrix();
+void finalize_matrix();
+
+// callsite.c
+CNTD_CallSite_t* get_callsite(MPI_Type_t mpi_type, void *addr);
+void callsite_start(MPI_Type_t mpi_type, void *addr);
+void callsite_end(uint64_t mpi_ticks, int eam_flag);
+int predict_callsite(CNTD_CallSite_t *site, uint64_t timeout_ticks);
+int get_callsite_report(CNTD_CallSiteReport_t **report);
+void resolve_callsites(CNTD_CallSiteReport_t *sites, int num_sites, CNTD_CallSiteName_t *names);
+void init_callsite();
+void finalize_callsite();
+
+// request.c
+void add_request(MPI_Type_t mpi_type, MPI_Request request, int peer, const uint64_t *start_data);
+void add_request_f(MPI_Type_t mpi_type, MPI_Fint request, int peer, const uint64_t *start_data);
+void add_request_p2p_init(MPI_Type_t mpi_type, MPI_Comm comm, MPI_Request request, int peer, const uint64_t *start_data);
+void add_request_p2p_init_f(MPI_Type_t mpi_type, MPI_Fint comm, MPI_Fint request, int peer, const uint64_t *start_data);
+void start_requests(int count, const MPI_Request *requests);
+void start_requests_f(int count, const MPI_Fint *requests);
+MPI_Request* save_requests(int count, const MPI_Request *requests);
+MPI_Request* save_requests_f(int count, const MPI_Fint *requests);
+void complete_requests(int count, const MPI_Request *saved, const int *indices, int base);
+void free_request(MPI_Request request);
+void free_request_f(MPI_Fint request);
+void cancel_request(MPI_Request request);
+void cancel_request_f(MPI_Fint request);
+void request_end(MPI_Type_t mpi_type, uint64_t mpi_ticks, int eam_flag);
+void print_request_report();
+void init_request();
+void finalize_request();
 
 // eam.c
-void eam_start_mpi();
-int eam_end_mpi();
-void eam_init();
-void eam_finalize();
+void eam_lower_pstate();
+uint64_t eam_get_epoch();
+int eam_restore_pstate(uint64_t epoch);
+extern HIDDEN const CNTD_Policy_t eam_policy;
 
 // eam_slack.c
-void eam_slack_start_mpi(MPI_Type_t mpi_type, MPI_Comm comm, int addr);
-int eam_slack_end_mpi(MPI_Type_t mpi_type, MPI_Comm comm, int addr);
-void eam_slack_init();
-void eam_slack_finalize();
+extern HIDDEN const CNTD_Policy_t eam_slack_policy;
+
+// instrument.c
+int parse_mpi_class_list(const char str[]);
+int parse_account_rate(const char str[], uint32_t rate[]);
+void init_instrument();
+void finalize_instrument();
+
+// policy.c
+void init_policy();
+void finalize_policy();
 
 // pm.c
 void set_pstate(int pstate);
 void set_max_pstate();
 void set_min_pstate();
+int parse_pstate_ladder(const char str[], double time[], int pstate[]);
 int get_maximum_turbo_frequency();
 int get_minimum_frequency();
 void pm_init();
@@ -599,6 +1185,9 @@ void set_min_aw();
 
 // report.c
 void print_final_report();
+void print_callsite_report();
+void print_msg_size_report();
+void print_ladder_report();
 void init_timeseries_report();
 void send_mosquitto_report_general(char* topic_ending, double payload_value);
 void send_mosquitto_report(char* topic_ending,
@@ -616,24 +1205,45 @@ void finalize_timeseries_report();
 
 // sampling.c
 void event_sample_start(MPI_Type_t mpi_type);
-void event_sample_end(MPI_Type_t mpi_type, int eam);
+uint64_t event_sample_end(MPI_Type_t mpi_type, int eam);
+void fold_thread_counters(CNTD_ThreadCounters_t *counters);
+void convert_ticks();
 void init_time_sample();
 void finalize_time_sample();
 void time_sample(int sig, siginfo_t *siginfo, void *context);
 
 // timer.c
 void start_timer();
+void start_timer_ticks(uint64_t timeout_ticks);
+void rearm_timer(uint64_t timeout_ticks);
 void reset_timer();
 void init_timer();
 void finalize_timer();
 int make_timer(timer_t *timerID, void (*func)(int, siginfo_t*, void*), int interval, int expire);
 int delete_timer(timer_t timerID);
 
+// timeout.c
+void init_adaptive_timeout();
+void add_timeout_sample(MPI_Type_t mpi_type, uint64_t ticks);
+void reduce_timeout_stats(double *stats);
+
+// powercap.c
+void init_power_cap();
+void finalize_power_cap();
+
+// uncore.c
+void init_uncore();
+void finalize_uncore();
+void uncore_enter_wait();
+void uncore_leave_wait();
+
 // tool.c
 int str_to_bool(const char str[]);
 int read_str_from_file(char *filename, char *str);
 int write_int_to_file(char* filename, int value);
+int write_uint64_to_file(char *filename, uint64_t value);
 double read_time();
+void init_ticks();
 uint64_t diff_overflow(uint64_t end, uint64_t start, uint64_t overflow);
 int makedir(const char dir[]);
 int copyFile(char *source, char *desitnation);
@@ -648,12 +1258,109 @@ CNTD_RankInfo_t* get_shmem_cpu(const char shmem_name[], int num_elem);
 void add_network(MPI_Comm comm, MPI_Type_t type,
     const int *send_count, MPI_Datatype *send_type, int dest,
 	const int *recv_count, MPI_Datatype *recv_type, int source);
+void add_network_c(MPI_Comm comm, MPI_Type_t type,
+    const MPI_Count *send_count, MPI_Datatype *send_type, int dest,
+	const MPI_Count *recv_count, MPI_Datatype *recv_type, int source);
+void add_network_persistent(MPI_Comm comm, MPI_Type_t type,
+    const int *send_count, MPI_Datatype *send_type, int dest,
+	const int *recv_count, MPI_Datatype *recv_type, int source, uint64_t *start_data);
+void add_network_persistent_c(MPI_Comm comm, MPI_Type_t type,
+    const MPI_Count *send_count, MPI_Datatype *send_type, int dest,
+	const MPI_Count *recv_count, MPI_Datatype *recv_type, int source, uint64_t *start_data);
+void add_network_allw_f(MPI_Comm comm, MPI_Type_t type,
+	const MPI_Fint *send_count, const MPI_Fint *send_type,
+	const MPI_Fint *recv_count, const MPI_Fint *recv_type);
+void add_start(MPI_Type_t type, const uint64_t *start_data, int peer);
 void add_file(MPI_Type_t type,
-	int read_count, MPI_Datatype read_datatype,
-	int write_count, MPI_Datatype write_datatype);
+	MPI_Count read_count, MPI_Datatype read_datatype,
+	MPI_Count write_count, MPI_Datatype write_datatype);
 void get_rand_postfix(char *postfix, int size);
 #ifdef INTEL
 int read_intel_nom_freq();
 #endif
 
+// Prologue of every intercepted MPI call, inlined in the generated wrappers
+static inline __attribute__((always_inline))
+void call_start(MPI_Type_t mpi_type, MPI_Comm comm, void *addr, const int flags)
+{
+	int in_mpi;
+	uint64_t ticks = read_ticks();
+
+	if(!cntd_thread.registered)
+		register_thread();
+
+	if(cntd->thread_multiple)
+		in_mpi = __atomic_add_fetch(&cntd->threads_in_mpi, 1, __ATOMIC_ACQ_REL);
+	else
+		in_mpi = ++cntd->threads_in_mpi;
+
+	// The first thread entering publishes the wait to the power cap controller
+	if((flags & CALL_EAM) && cntd->enable_power_cap && in_mpi == 1)
+		__atomic_store_n(&cntd->rank->mpi_entry_ticks, ticks, __ATOMIC_RELEASE);
+
+	cntd_thread.call_data = 0;
+	cntd_thread.weight = get_account_weight(mpi_type);
+
+	if(cntd->enable_callsite || cntd->enable_eam_predict)
+		callsite_start(mpi_type, addr);
+
+	// Local accessory calls are too short for the energy-aware policies
+	if(flags & CALL_EAM)
+		cntd->policy.on_enter(mpi_type, comm, addr);
+
+	event_sample_start(mpi_type);
+
+	// Prologue cost, completed by the accounting and the epilogue of the call
+	cntd_thread.overhead_ticks = read_ticks() - ticks;
+}
+
+// Epilogue of every intercepted MPI call, inlined in the generated wrappers
+static inline __attribute__((always_inline))
+void call_end(MPI_Type_t mpi_type, MPI_Comm comm, void *addr, const int flags)
+{
+	int in_mpi;
+	int eam_flag = FALSE;
+	uint64_t mpi_ticks;
+	uint64_t ticks = read_ticks();
+
+	// Leave before restoring the p-state, so the watchdog cannot lower it again
+	if(cntd->thread_multiple)
+		in_mpi = __atomic_sub_fetch(&cntd->threads_in_mpi, 1, __ATOMIC_ACQ_REL);
+	else
+		in_mpi = --cntd->threads_in_mpi;
+
+	if(cntd->enable_power_cap && in_mpi == 0)
+		__atomic_store_n(&cntd->rank->mpi_entry_ticks, 0, __ATOMIC_RELEASE);
+
+	if(flags & CALL_EAM)
+		eam_flag = cntd->policy.on_exit(mpi_type, comm, addr);
+
+	mpi_ticks = event_sample_end(mpi_type, eam_flag);
+
+	if(cntd->enable_request)
+		request_end(mpi_type, mpi_ticks, eam_flag);
+
+	if((flags & CALL_COLL) && cntd->enable_matrix && cntd_thread.weight > 0 && comm != MPI_COMM_NULL)
+		add_matrix_coll(comm, cntd_thread.call_data);
+
+	if(cntd->enable_callsite || cntd->enable_eam_predict)
+		callsite_end(mpi_ticks, eam_flag);
+
+	// Polling calls merged in an episode are sampled by the episode
+	if((flags & CALL_EAM) && cntd->enable_adaptive_timeout &&
+		!(CALL_CLASS(flags) == MPI_CLASS_POLLING && cntd->enable_poll))
+		add_timeout_sample(mpi_type, mpi_ticks);
+
+	// Ranks with slack at the collectives lower the frequency of the compute phases
+	if((flags & CALL_COLL) && cntd->enable_imbalance)
+		imbalance_end(mpi_type, comm);
+
+	CALL_COUNTER(overhead_ticks[CALL_CLASS(flags)]) +=
+		cntd_thread.overhead_ticks + (read_ticks() - ticks);
+
+	if(cntd->thread_multiple &&
+		cntd_thread.ticks[END] - cntd_thread.slot->counters->fold_ticks > cntd->thread_fold_ticks)
+		fold_thread_counters(cntd_thread.slot->counters);
+}
+
 #endif // __CNTD_H__
@@ -43,25 +43,33 @@
 	MPI(__MPI_ADDRESS) \
 	MPI(__MPI_ALLGATHER) \
 	MPI(__MPI_IALLGATHER) \
+	MPI(__MPI_ALLGATHER_INIT) \
 	MPI(__MPI_ALLGATHERV) \
 	MPI(__MPI_IALLGATHERV) \
+	MPI(__MPI_ALLGATHERV_INIT) \
 	MPI(__MPI_ALLOC_MEM) \
 	MPI(__MPI_ALLREDUCE) \
 	MPI(__MPI_IALLREDUCE) \
+	MPI(__MPI_ALLREDUCE_INIT) \
 	MPI(__MPI_ALLTOALL) \
 	MPI(__MPI_IALLTOALL) \
+	MPI(__MPI_ALLTOALL_INIT) \
 	MPI(__MPI_ALLTOALLV) \
 	MPI(__MPI_IALLTOALLV) \
+	MPI(__MPI_ALLTOALLV_INIT) \
 	MPI(__MPI_ALLTOALLW) \
 	MPI(__MPI_IALLTOALLW) \
+	MPI(__MPI_ALLTOALLW_INIT) \
 	MPI(__MPI_ATTR_DELETE) \
 	MPI(__MPI_ATTR_GET) \
 	MPI(__MPI_ATTR_PUT) \
 	MPI(__MPI_BARRIER) \
 	MPI(__MPI_IBARRIER) \
+	MPI(__MPI_BARRIER_INIT) \
 	MPI(__MPI_BCAST) \
 	MPI(__MPI_BSEND) \
 	MPI(__MPI_IBCAST) \
+	MPI(__MPI_BCAST_INIT) \
 	MPI(__MPI_BSEND_INIT) \
 	MPI(__MPI_BUFFER_ATTACH) \
 	MPI(__MPI_BUFFER_DETACH) \
@@ -129,6 +137,7 @@
 	MPI(__MPI_EXSCAN) \
 	MPI(__MPI_FETCH_AND_OP) \
 	MPI(__MPI_IEXSCAN) \
+	MPI(__MPI_EXSCAN_INIT) \
 	MPI(__MPI_FILE_C2F) \
 	MPI(__MPI_FILE_F2C) \
 	MPI(__MPI_FILE_CALL_ERRHANDLER) \
@@ -194,8 +203,10 @@
 	MPI(__MPI_FREE_MEM) \
 	MPI(__MPI_GATHER) \
 	MPI(__MPI_IGATHER) \
+	MPI(__MPI_GATHER_INIT) \
 	MPI(__MPI_GATHERV) \
 	MPI(__MPI_IGATHERV) \
+	MPI(__MPI_GATHERV_INIT) \
 	MPI(__MPI_GET_ADDRESS) \
 	MPI(__MPI_GET_COUNT) \
 	MPI(__MPI_GET_ELEMENTS) \
@@ -259,14 +270,19 @@
 	MPI(__MPI_MRECV) \
 	MPI(__MPI_NEIGHBOR_ALLGATHER) \
 	MPI(__MPI_INEIGHBOR_ALLGATHER) \
+	MPI(__MPI_NEIGHBOR_ALLGATHER_INIT) \
 	MPI(__MPI_NEIGHBOR_ALLGATHERV) \
 	MPI(__MPI_INEIGHBOR_ALLGATHERV) \
+	MPI(__MPI_NEIGHBOR_ALLGATHERV_INIT) \
 	MPI(__MPI_NEIGHBOR_ALLTOALL) \
 	MPI(__MPI_INEIGHBOR_ALLTOALL) \
+	MPI(__MPI_NEIGHBOR_ALLTOALL_INIT) \
 	MPI(__MPI_NEIGHBOR_ALLTOALLV) \
 	MPI(__MPI_INEIGHBOR_ALLTOALLV) \
+	MPI(__MPI_NEIGHBOR_ALLTOALLV_INIT) \
 	MPI(__MPI_NEIGHBOR_ALLTOALLW) \
 	MPI(__MPI_INEIGHBOR_ALLTOALLW) \
+	MPI(__MPI_NEIGHBOR_ALLTOALLW_INIT) \
 	MPI(__MPI_FMPI_OP_C2F) \
 	MPI(__MPI_OP_COMMUTATIVE) \
 	MPI(__MPI_OP_CREATE) \
@@ -277,8 +293,14 @@
 	MPI(__MPI_PACK_EXTERNAL_SIZE) \
 	MPI(__MPI_PACK) \
 	MPI(__MPI_PACK_SIZE) \
+	MPI(__MPI_PARRIVED) \
 	MPI(__MPI_PCONTROL) \
+	MPI(__MPI_PRECV_INIT) \
+	MPI(__MPI_PREADY) \
+	MPI(__MPI_PREADY_LIST) \
+	MPI(__MPI_PREADY_RANGE) \
 	MPI(__MPI_PROBE) \
+	MPI(__MPI_PSEND_INIT) \
 	MPI(__MPI_PUBLISH_NAME) \
 	MPI(__MPI_PUT) \
 	MPI(__MPI_QUERY_THREAD) \
@@ -287,11 +309,14 @@
 	MPI(__MPI_RECV) \
 	MPI(__MPI_REDUCE) \
 	MPI(__MPI_IREDUCE) \
+	MPI(__MPI_REDUCE_INIT) \
 	MPI(__MPI_REDUCE_LOCAL) \
 	MPI(__MPI_REDUCE_SCATTER) \
 	MPI(__MPI_IREDUCE_SCATTER) \
+	MPI(__MPI_REDUCE_SCATTER_INIT) \
 	MPI(__MPI_REDUCE_SCATTER_BLOCK) \
 	MPI(__MPI_IREDUCE_SCATTER_BLOCK) \
+	MPI(__MPI_REDUCE_SCATTER_BLOCK_INIT) \
 	MPI(__MPI_REGISTER_DATAREP) \
 	MPI(__MPI_FMPI_REQUEST_C2F) \
 	MPI(__MPI_REQUEST_F2C) \
@@ -304,10 +329,13 @@
 	MPI(__MPI_RSEND_INIT) \
 	MPI(__MPI_SCAN) \
 	MPI(__MPI_ISCAN) \
+	MPI(__MPI_SCAN_INIT) \
 	MPI(__MPI_SCATTER) \
 	MPI(__MPI_ISCATTER) \
+	MPI(__MPI_SCATTER_INIT) \
 	MPI(__MPI_SCATTERV) \
 	MPI(__MPI_ISCATTERV) \
+	MPI(__MPI_SCATTERV_INIT) \
 	MPI(__MPI_SEND_INIT) \
 	MPI(__MPI_SEND) \
 	MPI(__MPI_SENDRECV) \
@@ -445,6 +473,7 @@
 	MPI(__MPI_NEIGHBOR_ALLTOALLV__BARRIER) \
 	MPI(__MPI_NEIGHBOR_ALLTOALLW__BARRIER) \
 	MPI(__MPI_PROBE__BARRIER) \
+	MPI(__MPI_POLL_EPISODE) \
 	MPI(__MPI_FINALIZE) \
 	MPI(NUM_MPI_TYPE) \
 	MPI(NO_MPI) \
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Interface of the energy-aware MPI policies. A policy is a table of
+// callbacks selected once at startup: the built-in ones are "countdown" and
+// "slack", an external one is a shared object named by CNTD_POLICY that
+// exports CNTD_POLICY_SYMBOL with the CNTD_PolicyRegister_t prototype.
+
+#ifndef __CNTD_POLICY_H__
+#define __CNTD_POLICY_H__
+
+#include <stdint.h>
+#include <mpi.h>
+
+#define CNTD_POLICY_VERSION				1
+#define CNTD_POLICY_SYMBOL				"cntd_policy_register"
+
+// Services of COUNTDOWN available to the policies
+typedef struct
+{
+	int version;
+	int world_rank;
+	int local_rank;
+
+	// Timeout of the policies in seconds (CNTD_TIMEOUT) and tick frequency in Hz
+	double eam_timeout;
+	double tick_freq;
+
+	// MPI class and name of every MPI type, indexes of mpi_class_str
+	const uint8_t *mpi_type_class;
+	const char *const *mpi_type_str;
+	const char *const *mpi_class_str;
+
+	uint64_t (*read_ticks)(void);
+
+	// P-state control of the CPU of the rank
+	void (*set_pstate)(int pstate);
+	void (*set_max_pstate)(void);
+	void (*set_min_pstate)(void);
+
+	// Lower the p-state when all the threads of the rank wait in MPI, and
+	// restore it if it was lowered after the epoch read at the call entry
+	void (*lower_pstate)(void);
+	uint64_t (*get_epoch)(void);
+	int (*restore_pstate)(uint64_t epoch);
+
+	// Timeout of the rank, a signal timer or the watchdog thread
+	void (*init_timer)(void (*callback)());
+	void (*start_timer)(void);
+	void (*reset_timer)(void);
+	void (*finalize_timer)(void);
+} CNTD_PolicyHost_t;
+
+// Callbacks of a policy, on_enter and on_exit are required. on_exit returns
+// non-zero if the call has run at a lowered p-state. on_sample is called on
+// the local master of every node at each sampling period.
+typedef struct
+{
+	int version;
+	const char *name;
+	void (*init)(void);
+	void (*on_enter)(int mpi_type, MPI_Comm comm, void *addr);
+	int (*on_exit)(int mpi_type, MPI_Comm comm, void *addr);
+	void (*on_sample)(void);
+	void (*finalize)(void);
+} CNTD_Policy_t;
+
+// Fill the policy, return 0 on success
+typedef int (*CNTD_PolicyRegister_t)(const CNTD_PolicyHost_t *host, CNTD_Policy_t *policy);
+
+#endif // __CNTD_POLICY_H__
@@ -30,48 +30,477 @@
 
 #include "cntd.h"
 
-static int flag_eam = FALSE;
+// The callback bumps the epoch when it lowers the p-state, a call whose
+// entry epoch differs at exit has spent time at the minimum p-state.
+// Under MPI_THREAD_MULTIPLE eam_lowered hands the p-state over between the
+// threads: a thread changes it only after moving eam_lowered from FALSE or
+// TRUE to LOWERING, or from TRUE to RESTORING.
+#define EAM_LOWERING	2
+#define EAM_RESTORING	3
+static uint64_t eam_epoch = 0;
+static int eam_lowered = FALSE;
+static THREAD_LOCAL uint64_t entry_epoch = 0;
+static THREAD_LOCAL int timer_armed = FALSE;
+
+// P-state ladder: the first step is taken at the timeout, every next one when
+// the timer re-armed by the previous step expires. The restore leaves the
+// ladder and accounts the time of every step to the MPI type of the wait,
+// published by the thread arming the timer.
+HIDDEN uint64_t mpi_type_ladder_cnt[NUM_MPI_TYPE][MAX_LADDER_STEPS];
+HIDDEN uint64_t mpi_type_ladder_ticks[NUM_MPI_TYPE][MAX_LADDER_STEPS];
+static int ladder_step = -1;
+static MPI_Type_t ladder_type;
+static MPI_Type_t ladder_armed_type;
+static uint64_t ladder_start[MAX_LADDER_STEPS];
+
+// While polling episodes are open the timer fires every gap to expire them.
+// eam_due holds the time of the pending step of the timeout (0 if none), a
+// firing armed only to expire the episodes does not take it earlier.
+static uint64_t eam_due = 0;
+static int eam_recheck = FALSE;
+
+static int eam_claim(int from)
+{
+	return __atomic_compare_exchange_n(&eam_lowered, &from, EAM_LOWERING,
+		FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static void eam_release(int to)
+{
+	if(cntd->thread_multiple)
+		__atomic_store_n(&eam_lowered, to, __ATOMIC_RELEASE);
+}
+
+// Threads polling between the tests of an open episode, until they have
+// been computing for longer than the gap
+static int poll_waiting_threads(uint64_t now)
+{
+	int i, waiting = 0;
+
+	if(!cntd->enable_poll || __atomic_load_n(&cntd->threads_polling, __ATOMIC_ACQUIRE) == 0)
+		return 0;
+
+	for(i = 0; i < MAX_NUM_THREADS; i++)
+	{
+		CNTD_ThreadSlot_t *slot = &cntd->threads[i];
+		uint64_t last = __atomic_load_n(&slot->poll_last, __ATOMIC_ACQUIRE);
+
+		// A thread inside a test is already counted in threads_in_mpi
+		if(__atomic_load_n(&slot->poll_active, __ATOMIC_ACQUIRE) == TRUE &&
+			last != POLL_IN_CALL && (now < last || now - last <= cntd->poll_gap_ticks))
+			waiting++;
+	}
+	return waiting;
+}
+
+// Under MPI_THREAD_MULTIPLE the p-state is lowered only when all the threads
+// of the rank that call MPI are waiting inside MPI or in a polling episode.
+// On success the caller lowers the p-state and releases it with
+// eam_release(TRUE).
+static int eam_lower_epoch()
+{
+	if(cntd->thread_multiple)
+	{
+		if(__atomic_load_n(&cntd->threads_in_mpi, __ATOMIC_ACQUIRE) + poll_waiting_threads(read_ticks()) <
+			__atomic_load_n(&cntd->num_threads, __ATOMIC_ACQUIRE))
+			return FALSE;
+		if(!eam_claim(FALSE))
+			return FALSE;
+	}
+
+	__atomic_add_fetch(&eam_epoch, 1, __ATOMIC_RELEASE);
+	if(cntd->enable_uncore)
+		uncore_enter_wait();
+	return TRUE;
+}
+
+HIDDEN void eam_lower_pstate()
+{
+	if(eam_lower_epoch())
+	{
+		set_min_pstate();
+		eam_release(TRUE);
+	}
+}
+
+// Take the next step of the ladder, the first one for the given MPI type.
+// Return the ticks to the following step or 0 at the last step.
+static uint64_t eam_ladder_step(MPI_Type_t mpi_type)
+{
+	int step = __atomic_load_n(&ladder_step, __ATOMIC_ACQUIRE) + 1;
+
+	if(step == cntd->num_ladder_steps)
+		return 0;
+	if(step == 0)
+	{
+		if(!eam_lower_epoch())
+			return 0;
+		ladder_type = mpi_type;
+	}
+	else if(cntd->thread_multiple)
+	{
+		if(!eam_claim(TRUE))
+			return 0;
+		// The ladder may have been closed since the step was read
+		if(__atomic_load_n(&ladder_step, __ATOMIC_ACQUIRE) != step - 1)
+		{
+			eam_release(TRUE);
+			return 0;
+		}
+	}
+
+	set_pstate(cntd->ladder_pstate[step]);
+	ladder_start[step] = read_ticks();
+	__atomic_store_n(&ladder_step, step, __ATOMIC_RELEASE);
+	eam_release(TRUE);
+
+	if(step + 1 < cntd->num_ladder_steps)
+		return cntd->ladder_ticks[step + 1] - cntd->ladder_ticks[step];
+	return 0;
+}
+
+static void eam_ladder_end()
+{
+	int i;
+	uint64_t end = read_ticks();
+
+	for(i = __atomic_load_n(&ladder_step, __ATOMIC_ACQUIRE); i >= 0; i--)
+	{
+		add_counter(&mpi_type_ladder_cnt[ladder_type][i], 1);
+		add_counter(&mpi_type_ladder_ticks[ladder_type][i], end - ladder_start[i]);
+		end = ladder_start[i];
+	}
+	__atomic_store_n(&ladder_step, -1, __ATOMIC_RELEASE);
+}
+
+// Publish the MPI type of the wait before arming the timer
+static void eam_arm_timer(MPI_Type_t mpi_type, uint64_t timeout_ticks)
+{
+	__atomic_store_n(&ladder_armed_type, mpi_type, __ATOMIC_RELEASE);
+	__atomic_store_n(&eam_due, read_ticks() + timeout_ticks, __ATOMIC_RELEASE);
+	__atomic_store_n(&eam_recheck, FALSE, __ATOMIC_RELEASE);
+	start_timer_ticks(timeout_ticks);
+}
+
+HIDDEN uint64_t eam_get_epoch()
+{
+	return __atomic_load_n(&eam_epoch, __ATOMIC_ACQUIRE);
+}
+
+// Under MPI_THREAD_MULTIPLE claim the restore of the lowered p-state, after
+// a step being taken by another thread
+static int eam_claim_restore()
+{
+	int lowered;
+
+	for(;;)
+	{
+		lowered = TRUE;
+		if(__atomic_compare_exchange_n(&eam_lowered, &lowered, EAM_RESTORING,
+			FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			return TRUE;
+		if(lowered != EAM_LOWERING)
+			return FALSE;
+		cpu_relax();
+	}
+}
+
+// Restore the maximum p-state if it was lowered after the given epoch,
+// the first thread leaving MPI restores it for all the others
+HIDDEN int eam_restore_pstate(uint64_t epoch)
+{
+	if(__atomic_load_n(&eam_epoch, __ATOMIC_ACQUIRE) == epoch)
+		return FALSE;
+
+	if(!cntd->thread_multiple || eam_claim_restore())
+	{
+		set_max_pstate();
+		if(cntd->enable_uncore)
+			uncore_leave_wait();
+		if(__atomic_load_n(&ladder_step, __ATOMIC_ACQUIRE) >= 0)
+			eam_ladder_end();
+		// The p-state can be lowered again once the ladder is closed
+		eam_release(FALSE);
+	}
+	return TRUE;
+}
+
+// Take the pending step of the timeout. Return the ticks to the next one,
+// 0 at the last step.
+static uint64_t eam_timeout_step()
+{
+	if(cntd->num_ladder_steps > 0)
+		return eam_ladder_step(__atomic_load_n(&ladder_armed_type, __ATOMIC_ACQUIRE));
+	eam_lower_pstate();
+	return 0;
+}
 
 static void eam_callback()
 {
-	flag_eam = TRUE;
-	set_min_pstate();
+	uint64_t next_ticks = eam_timeout_step();
+
+	if(next_ticks > 0)
+		rearm_timer(next_ticks);
 }
 
-HIDDEN void eam_start_mpi()
+// Expire the polling episodes whose thread has been computing for longer
+// than the gap since its last test, restoring the p-state lowered during the
+// episode. The thread accounts the episode at its next MPI call.
+static void expire_poll_episodes(uint64_t now)
 {
-	flag_eam = FALSE;
-	if(cntd->eam_timeout > 0)
-		start_timer();
-	else
-		eam_callback();
+	int i, active;
+
+	for(i = 0; i < MAX_NUM_THREADS; i++)
+	{
+		CNTD_ThreadSlot_t *slot = &cntd->threads[i];
+		uint64_t last = __atomic_load_n(&slot->poll_last, __ATOMIC_ACQUIRE);
+
+		if(last == POLL_IN_CALL || now < last || now - last <= cntd->poll_gap_ticks)
+			continue;
+
+		active = TRUE;
+		if(!__atomic_compare_exchange_n(&slot->poll_active, &active, POLL_EXPIRING,
+			FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			continue;
+
+		__atomic_sub_fetch(&cntd->threads_polling, 1, __ATOMIC_ACQ_REL);
+		slot->poll_restored = eam_restore_pstate(slot->poll_epoch);
+		// The slot of an exited thread is free for reuse at once
+		__atomic_store_n(&slot->poll_active,
+			__atomic_load_n(&slot->used, __ATOMIC_ACQUIRE) ? POLL_EXPIRED : FALSE, __ATOMIC_RELEASE);
+	}
 }
 
-HIDDEN int eam_end_mpi()
+static void eam_timer_callback()
 {
-	if(cntd->eam_timeout > 0)
+	int polling = FALSE;
+	uint64_t due, next_ticks = 0;
+	uint64_t now = read_ticks();
+
+	if(cntd->enable_poll && __atomic_load_n(&cntd->threads_polling, __ATOMIC_ACQUIRE) > 0)
+	{
+		expire_poll_episodes(now);
+		polling = __atomic_load_n(&cntd->threads_polling, __ATOMIC_ACQUIRE) > 0;
+
+		// Armed by polling episodes whose threads are all computing again
+		if(!polling && __atomic_load_n(&cntd->threads_in_mpi, __ATOMIC_ACQUIRE) == 0)
+			return;
+	}
+
+	due = __atomic_load_n(&eam_due, __ATOMIC_ACQUIRE);
+	if(!__atomic_load_n(&eam_recheck, __ATOMIC_ACQUIRE) || (due > 0 && now >= due))
+	{
+		next_ticks = eam_timeout_step();
+		__atomic_store_n(&eam_due, next_ticks > 0 ? now + next_ticks : 0, __ATOMIC_RELEASE);
+	}
+	else if(due > 0)
+		next_ticks = due - now;
+
+	// Fire again within the gap to expire the open episodes
+	__atomic_store_n(&eam_recheck, FALSE, __ATOMIC_RELEASE);
+	if(polling && (next_ticks == 0 || next_ticks > cntd->poll_gap_ticks))
+	{
+		next_ticks = cntd->poll_gap_ticks;
+		__atomic_store_n(&eam_recheck, TRUE, __ATOMIC_RELEASE);
+	}
+	if(next_ticks > 0)
+		rearm_timer(next_ticks);
+}
+
+// Close the polling episode of the thread, or account the one expired by the
+// timer callback
+static int end_poll_episode(uint64_t end_ticks)
+{
+	int eam_flag, active = TRUE;
+	CNTD_ThreadSlot_t *slot = cntd_thread.slot;
+	uint64_t ticks = end_ticks - cntd_thread.poll_ticks;
+	uint64_t timeout_ticks = get_eam_timeout_ticks(__MPI_POLL_EPISODE);
+
+	if(__atomic_compare_exchange_n(&slot->poll_active, &active, FALSE,
+		FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+	{
 		reset_timer();
+		__atomic_sub_fetch(&cntd->threads_polling, 1, __ATOMIC_ACQ_REL);
+		eam_flag = eam_restore_pstate(slot->poll_epoch);
+	}
+	else
+	{
+		while(__atomic_load_n(&slot->poll_active, __ATOMIC_ACQUIRE) == POLL_EXPIRING)
+			cpu_relax();
+		eam_flag = slot->poll_restored;
+		__atomic_store_n(&slot->poll_active, FALSE, __ATOMIC_RELEASE);
+	}
 
-	// Set maximum frequency if timer is expired
-	if(flag_eam)
+	// Episodes are reported as their own MPI type, not added to the MPI time
+	touch_call_counters(__MPI_POLL_EPISODE);
+	CALL_COUNTER(mpi_type_cnt[__MPI_POLL_EPISODE]) += 1;
+	CALL_COUNTER(mpi_type_ticks[__MPI_POLL_EPISODE]) += ticks;
+	if(eam_flag && ticks > timeout_ticks)
 	{
-		set_max_pstate();
-		flag_eam = FALSE;
-		return TRUE;
+		CALL_COUNTER(cntd_mpi_type_cnt[__MPI_POLL_EPISODE]) += 1;
+		CALL_COUNTER(cntd_mpi_type_ticks[__MPI_POLL_EPISODE]) += ticks - timeout_ticks;
+	}
+	if(cntd->enable_adaptive_timeout)
+		add_timeout_sample(__MPI_POLL_EPISODE, ticks);
+	return eam_flag;
+}
+
+// Called at the start of every MPI call: the episode ends when another MPI
+// call or polling site is entered, or when the application gap was too long
+static void eam_poll_start(MPI_Type_t mpi_type, void *addr)
+{
+	CNTD_ThreadSlot_t *slot = cntd_thread.slot;
+	int active = __atomic_load_n(&slot->poll_active, __ATOMIC_ACQUIRE);
+
+	if(active == FALSE)
+		return;
+
+	if(active != TRUE || mpi_type_class[mpi_type] != MPI_CLASS_POLLING || addr != cntd_thread.poll_site ||
+		read_ticks() - cntd_thread.ticks[END] > cntd->poll_gap_ticks)
+		end_poll_episode(cntd_thread.ticks[END]);
+	else
+		__atomic_store_n(&slot->poll_last, POLL_IN_CALL, __ATOMIC_RELEASE);
+}
+
+// Called at the end of a polling call instead of eam_end_mpi. The first
+// unsuccessful test opens the episode and arms the timeout, a successful
+// one closes it.
+static int eam_poll_end(void *addr)
+{
+	CNTD_ThreadSlot_t *slot = cntd_thread.slot;
+	int active = __atomic_load_n(&slot->poll_active, __ATOMIC_ACQUIRE);
+
+	if(active == TRUE)
+	{
+		if(cntd_thread.poll_done)
+			return end_poll_episode(read_ticks());
+		__atomic_store_n(&slot->poll_last, read_ticks(), __ATOMIC_RELEASE);
+		return FALSE;
+	}
+
+	// Expired by the timer callback since the start of the call
+	if(active != FALSE)
+		end_poll_episode(cntd_thread.ticks[END]);
+
+	if(!cntd_thread.poll_done)
+	{
+		cntd_thread.poll_site = addr;
+		cntd_thread.poll_ticks = cntd_thread.ticks[START];
+		slot->poll_epoch = eam_get_epoch();
+		__atomic_store_n(&slot->poll_last, read_ticks(), __ATOMIC_RELEASE);
+
+		// The thread is waiting also between the calls of the episode
+		__atomic_add_fetch(&cntd->threads_polling, 1, __ATOMIC_ACQ_REL);
+		__atomic_store_n(&slot->poll_active, TRUE, __ATOMIC_RELEASE);
+
+		if(cntd->eam_timeout > 0)
+		{
+			uint64_t timeout_ticks = get_eam_timeout_ticks(__MPI_POLL_EPISODE);
+			if(timeout_ticks != EAM_TIMEOUT_NEVER)
+				eam_arm_timer(__MPI_POLL_EPISODE, timeout_ticks);
+		}
+		else
+		{
+			eam_lower_pstate();
+			__atomic_store_n(&eam_due, 0, __ATOMIC_RELEASE);
+			__atomic_store_n(&eam_recheck, TRUE, __ATOMIC_RELEASE);
+			start_timer_ticks(cntd->poll_gap_ticks);
+		}
 	}
 	return FALSE;
 }
 
-HIDDEN void eam_init()
+static void eam_start_mpi(MPI_Type_t mpi_type, CNTD_CallSite_t *site)
 {
-	// Initialization of timer
+	entry_epoch = eam_get_epoch();
 	if(cntd->eam_timeout > 0)
-		init_timer(eam_callback);
+	{
+		uint64_t timeout_ticks = get_eam_timeout_ticks(mpi_type);
+
+		timer_armed = FALSE;
+		switch(predict_callsite(site, timeout_ticks))
+		{
+			// Long wait predicted, do not waste the timeout at high frequency
+			case EAM_PREDICT_LONG:
+				if(cntd->num_ladder_steps == 0)
+					eam_callback();
+				// The timer goes on with the next steps of the ladder
+				else if(__atomic_load_n(&ladder_step, __ATOMIC_ACQUIRE) < 0)
+				{
+					uint64_t next_ticks = eam_ladder_step(mpi_type);
+					if(next_ticks > 0)
+					{
+						timer_armed = TRUE;
+						eam_arm_timer(mpi_type, next_ticks);
+					}
+				}
+				break;
+			// Short call predicted, do not pay for the timer
+			case EAM_PREDICT_SHORT:
+				break;
+			default:
+				// No adaptive timeout of the MPI type pays off
+				if(timeout_ticks == EAM_TIMEOUT_NEVER)
+					break;
+				// A single timeout is shared by the threads, armed by the last one entering MPI
+				if(!cntd->thread_multiple || __atomic_load_n(&cntd->threads_in_mpi, __ATOMIC_ACQUIRE) +
+					__atomic_load_n(&cntd->threads_polling, __ATOMIC_ACQUIRE) >= cntd->num_threads)
+				{
+					timer_armed = TRUE;
+					eam_arm_timer(mpi_type, timeout_ticks);
+				}
+				break;
+		}
+	}
+	else
+		eam_callback();
 }
 
-HIDDEN void eam_finalize()
+static int eam_end_mpi()
+{
+	// A thread leaving MPI cancels the timeout armed by any other thread
+	if(timer_armed || (cntd->thread_multiple && cntd->eam_timeout > 0))
+		reset_timer();
+	timer_armed = FALSE;
+
+	// Set maximum frequency if timer is expired
+	return eam_restore_pstate(entry_epoch);
+}
+
+static void eam_enter(int mpi_type, MPI_Comm comm, void *addr)
+{
+	if(cntd->enable_poll)
+		eam_poll_start(mpi_type, addr);
+	if(!cntd->enable_poll || mpi_type_class[mpi_type] != MPI_CLASS_POLLING)
+		eam_start_mpi(mpi_type, cntd_thread.curr_site);
+}
+
+static int eam_exit(int mpi_type, MPI_Comm comm, void *addr)
+{
+	if(cntd->enable_poll && mpi_type_class[mpi_type] == MPI_CLASS_POLLING)
+		return eam_poll_end(addr);
+	return eam_end_mpi();
+}
+
+static void eam_init()
+{
+	// Initialization of timer, also expiring the polling episodes
+	if(cntd->eam_timeout > 0 || cntd->enable_poll)
+		init_timer(eam_timer_callback);
+}
+
+static void eam_finalize()
 {
 	// Reset timer and set maximum system p-state
-	if(cntd->eam_timeout > 0)
+	if(cntd->eam_timeout > 0 || cntd->enable_poll)
 		finalize_timer();
 }
+
+HIDDEN const CNTD_Policy_t eam_policy = {
+	.version = CNTD_POLICY_VERSION,
+	.name = "countdown",
+	.init = eam_init,
+	.on_enter = eam_enter,
+	.on_exit = eam_exit,
+	.on_sample = NULL,
+	.finalize = eam_finalize};
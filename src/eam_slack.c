@@ -30,12 +30,11 @@
 
 #include "cntd.h"
 
-static int flag_eam_slack = FALSE;
+static THREAD_LOCAL uint64_t entry_epoch = 0;
 
 static void eam_slack_callback()
 {
-	flag_eam_slack = TRUE;
-	set_min_pstate();
+	eam_lower_pstate();
 }
 
 static int is_wait_mpi(MPI_Type_t mpi_type)
@@ -159,13 +158,21 @@ static int is_p2p(MPI_Type_t mpi_type)
 	return FALSE;
 }
 
-HIDDEN void eam_slack_start_mpi(MPI_Type_t mpi_type, MPI_Comm comm, int addr)
+static void start_slack_timer(MPI_Type_t mpi_type)
+{
+	uint64_t timeout_ticks = get_eam_timeout_ticks(mpi_type);
+
+	if(timeout_ticks != EAM_TIMEOUT_NEVER)
+		start_timer_ticks(timeout_ticks);
+}
+
+static void eam_slack_start_mpi(int mpi_type, MPI_Comm comm, void *addr)
 {
 	if(is_wait_mpi(mpi_type) || is_p2p(mpi_type))
 	{
-		flag_eam_slack = FALSE;
+		entry_epoch = eam_get_epoch();
 		if(cntd->eam_timeout > 0)
-			start_timer();
+			start_slack_timer(mpi_type);
 		else
 			eam_slack_callback();
 	}
@@ -175,9 +182,9 @@ HIDDEN void eam_slack_start_mpi(MPI_Type_t mpi_type, MPI_Comm comm, int addr)
 
 		event_sample_start(type);
 
-		flag_eam_slack = FALSE;
+		uint64_t epoch = eam_get_epoch();
 		if(cntd->eam_timeout > 0)
-			start_timer();
+			start_slack_timer(type);
 		else
 			eam_slack_callback();
 
@@ -186,47 +193,44 @@ HIDDEN void eam_slack_start_mpi(MPI_Type_t mpi_type, MPI_Comm comm, int addr)
 		if(cntd->eam_timeout > 0)
 			reset_timer();
 
-		if(flag_eam_slack)
-		{
-			set_max_pstate();
-			flag_eam_slack = FALSE;
-
-			event_sample_end(type, TRUE);
-		}
-		else
-			event_sample_end(type, FALSE);
+		uint64_t ticks = event_sample_end(type, eam_restore_pstate(epoch));
+		if(cntd->enable_adaptive_timeout)
+			add_timeout_sample(type, ticks);
 	}
 }
 
-HIDDEN int eam_slack_end_mpi(MPI_Type_t mpi_type, MPI_Comm comm, int addr)
+static int eam_slack_end_mpi(int mpi_type, MPI_Comm comm, void *addr)
 {
 	if(is_wait_mpi(mpi_type) || is_p2p(mpi_type))
 	{
 		if(cntd->eam_timeout > 0)
 			reset_timer();
 
-		if(flag_eam_slack)
-		{
-			set_max_pstate();
-			flag_eam_slack = FALSE;
-
-			return TRUE;
-		}
+		return eam_restore_pstate(entry_epoch);
 	}
 
 	return FALSE;
 }
 
-HIDDEN void eam_slack_init()
+static void eam_slack_init()
 {
 	// Initialization of timer
 	if(cntd->eam_timeout > 0)
 		init_timer(eam_slack_callback);
 }
 
-HIDDEN void eam_slack_finalize()
+static void eam_slack_finalize()
 {
 	// Finalize timer
 	if(cntd->eam_timeout > 0)
 		finalize_timer();
 }
+
+HIDDEN const CNTD_Policy_t eam_slack_policy = {
+	.version = CNTD_POLICY_VERSION,
+	.name = "slack",
+	.init = eam_slack_init,
+	.on_enter = eam_slack_start_mpi,
+	.on_exit = eam_slack_end_mpi,
+	.on_sample = NULL,
+	.finalize = eam_slack_finalize};
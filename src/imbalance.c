@@ -0,0 +1,164 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+#ifndef __INTEL_COMPILER
+#include <math.h>
+#endif
+
+// Load-imbalance-driven DVFS of the compute phases. Every period of blocking
+// collectives on communicators congruent to MPI_COMM_WORLD the ranks exchange
+// the minimum MPI time of the period on a duplicate of MPI_COMM_WORLD. The MPI
+// time of a rank beyond the minimum is its slack, the time spent waiting for
+// the critical rank. A rank with slack in two consecutive periods lowers its
+// compute p-state to stretch the compute phases over the slack, short of a
+// guard percentage of the compute time, and gets back to the maximum p-state
+// as soon as its slack falls under half the guard.
+HIDDEN int imbalance_pstate = NO_CONF;
+
+static MPI_Comm comm_imbalance;
+static uint64_t imbalance_calls;
+static uint64_t last_app_ticks;
+static uint64_t last_mpi_ticks;
+static double last_slack;
+
+static int is_blocking_collective(MPI_Type_t mpi_type)
+{
+	switch(mpi_type)
+	{
+		case __MPI_ALLGATHER:
+		case __MPI_ALLGATHERV:
+		case __MPI_ALLREDUCE:
+		case __MPI_ALLTOALL:
+		case __MPI_ALLTOALLV:
+		case __MPI_ALLTOALLW:
+		case __MPI_BARRIER:
+		case __MPI_BCAST:
+		case __MPI_EXSCAN:
+		case __MPI_GATHER:
+		case __MPI_GATHERV:
+		case __MPI_REDUCE:
+		case __MPI_REDUCE_SCATTER:
+		case __MPI_REDUCE_SCATTER_BLOCK:
+		case __MPI_SCAN:
+		case __MPI_SCATTER:
+		case __MPI_SCATTERV:
+			return TRUE;
+		default:
+			return FALSE;
+	}
+}
+
+// New compute p-state from the slack of the period and the persistent one,
+// both in fractions of the compute time
+static int get_imbalance_pstate(double slack, double persistent)
+{
+	double guard = (double) cntd->imbalance_guard / 100.0;
+	int max_pstate = cntd->user_pstate[MAX] != NO_CONF ? cntd->user_pstate[MAX] : cntd->sys_pstate[MAX];
+	int min_pstate = cntd->user_pstate[MIN] != NO_CONF ? cntd->user_pstate[MIN] : cntd->sys_pstate[MIN];
+	int curr_pstate = imbalance_pstate != NO_CONF ? imbalance_pstate : max_pstate;
+	int pstate;
+
+	// Critical rank
+	if(slack < guard / 2)
+		return NO_CONF;
+	if(persistent <= guard)
+		return imbalance_pstate;
+
+	// The compute time scales with the inverse of the frequency
+	pstate = (int) ceil((double) curr_pstate / (1.0 + persistent - guard));
+	if(pstate < min_pstate)
+		pstate = min_pstate;
+	if(pstate >= max_pstate)
+		return NO_CONF;
+	return pstate;
+}
+
+// Called at the end of the collectives on the communicators congruent to
+// MPI_COMM_WORLD, which a correct program calls in the same order on all the
+// ranks. The exchange synchronizes like the blocking collective may already
+// do, and is not accounted as application time.
+HIDDEN void imbalance_end(MPI_Type_t mpi_type, MPI_Comm comm)
+{
+	int pstate;
+	uint64_t ticks, app_ticks, mpi_ticks;
+	double app_time, mpi_time, min_mpi_time, slack, persistent;
+
+	if(!is_blocking_collective(mpi_type) || !is_comm_world(comm) ||
+		++imbalance_calls % cntd->imbalance_period != 0)
+		return;
+
+	ticks = read_ticks();
+	app_ticks = cntd->rank->app_ticks;
+	mpi_ticks = cntd->rank->mpi_ticks;
+	app_time = ticks_to_sec(app_ticks - last_app_ticks);
+	mpi_time = ticks_to_sec(mpi_ticks - last_mpi_ticks);
+	last_app_ticks = app_ticks;
+	last_mpi_ticks = mpi_ticks;
+
+	PMPI_Allreduce(&mpi_time, &min_mpi_time, 1, MPI_DOUBLE, MPI_MIN, comm_imbalance);
+
+	slack = app_time > 0 ? (mpi_time - min_mpi_time) / app_time : 0;
+	persistent = slack < last_slack ? slack : last_slack;
+	last_slack = slack;
+
+	pstate = get_imbalance_pstate(slack, persistent);
+	if(pstate != imbalance_pstate)
+	{
+		imbalance_pstate = pstate;
+		if(cntd->enable_eam_freq)
+			set_max_pstate();
+	}
+
+	cntd_thread.ticks[END] += read_ticks() - ticks;
+}
+
+HIDDEN void init_imbalance()
+{
+	// The threads of a rank would count the collectives and run the
+	// exchange in a different order on every rank
+	if(cntd->thread_multiple)
+	{
+		if(cntd->rank->world_rank == 0)
+			fprintf(stderr, "Warning: <COUNTDOWN-node:%s-rank:%d> CNTD_IMBALANCE is not supported under MPI_THREAD_MULTIPLE, disabled\n",
+				cntd->node.hostname, cntd->rank->world_rank);
+		cntd->enable_imbalance = FALSE;
+		return;
+	}
+
+	PMPI_Comm_dup(MPI_COMM_WORLD, &comm_imbalance);
+}
+
+HIDDEN void finalize_imbalance()
+{
+	imbalance_pstate = NO_CONF;
+	PMPI_Comm_free(&comm_imbalance);
+}
@@ -31,10 +31,102 @@
 #include "cntd.h"
 
 CNTD_t *cntd;
+HIDDEN THREAD_LOCAL CNTD_Thread_t cntd_thread;
 #ifdef MOSQUITTO_ENABLED
 MOSQUITTO_t* mosq;
 #endif
 
+// An episode left open by the thread is expired by the timer callback, the
+// slot is reused once it is closed
+static void unregister_thread(void *arg)
+{
+	CNTD_ThreadSlot_t *slot = cntd_thread.slot;
+
+	if(slot != NULL)
+	{
+		if(slot->counters != NULL)
+			fold_thread_counters(slot->counters);
+		__atomic_store_n(&slot->poll_last, 0, __ATOMIC_RELEASE);
+		__atomic_store_n(&slot->used, FALSE, __ATOMIC_RELEASE);
+	}
+	__atomic_sub_fetch(&cntd->num_threads, 1, __ATOMIC_ACQ_REL);
+}
+
+// Count the threads of the rank calling MPI and give them a registry slot,
+// they leave at thread exit
+HIDDEN void register_thread()
+{
+	int i, used, active;
+
+	for(i = 0; i < MAX_NUM_THREADS; i++)
+	{
+		CNTD_ThreadSlot_t *slot = &cntd->threads[i];
+
+		used = FALSE;
+		active = __atomic_load_n(&slot->poll_active, __ATOMIC_ACQUIRE);
+		if((active == FALSE || active == POLL_EXPIRED) &&
+			__atomic_compare_exchange_n(&slot->used, &used, TRUE,
+				FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			// Not accounted, the thread owning the episode is gone
+			__atomic_store_n(&slot->poll_active, FALSE, __ATOMIC_RELEASE);
+			cntd_thread.slot = slot;
+			break;
+		}
+	}
+	if(i == MAX_NUM_THREADS)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> More than %d threads calling MPI\n",
+			cntd->node.hostname, cntd->rank->world_rank, MAX_NUM_THREADS);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	// Kept with the slot, cleared by the fold at the exit of the last owner
+	if(cntd->thread_multiple)
+	{
+		if(cntd_thread.slot->counters == NULL)
+		{
+			cntd_thread.slot->counters = calloc(1, sizeof(CNTD_ThreadCounters_t));
+			if(cntd_thread.slot->counters == NULL)
+			{
+				fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the thread counters\n",
+					cntd->node.hostname, cntd->rank->world_rank);
+				PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+			}
+		}
+		cntd_thread.slot->counters->fold_ticks = read_ticks();
+	}
+
+	cntd_thread.registered = TRUE;
+	cntd_thread.account_seed = (read_ticks() ^ ((uint64_t) cntd->rank->world_rank << 40)) | 1;
+	__atomic_add_fetch(&cntd->num_threads, 1, __ATOMIC_ACQ_REL);
+	pthread_setspecific(cntd->thread_key, &cntd_thread);
+}
+
+static void init_threads()
+{
+	int provided;
+
+	PMPI_Query_thread(&provided);
+	if(provided == MPI_THREAD_MULTIPLE)
+	{
+		cntd->thread_multiple = TRUE;
+
+		// A signal timer cannot be shared by the threads
+		if((cntd->enable_cntd || cntd->enable_cntd_slack) && (cntd->eam_timeout > 0 || cntd->enable_poll))
+			cntd->enable_watchdog = TRUE;
+	}
+	else
+		cntd->thread_multiple = FALSE;
+
+	if(pthread_key_create(&cntd->thread_key, unregister_thread) != 0)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to create the thread key\n",
+			cntd->node.hostname, cntd->rank->world_rank);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+}
+
 static void read_env()
 {
 	int i, j, world_rank;
@@ -91,6 +183,62 @@ static void read_env()
 		}
 	}
 
+	// Energy-aware MPI policy, built-in or loaded from a shared object
+	char *policy_str = getenv("CNTD_POLICY");
+	if(policy_str != NULL)
+	{
+		strncpy(cntd->policy_name, policy_str, STRING_SIZE - 1);
+		// Enabled with frequency scaling when neither CNTD_ENABLE nor CNTD_SLACK_ENABLE are set
+		if(!cntd->enable_cntd && !cntd->enable_cntd_slack)
+		{
+			if(strcasecmp(policy_str, "slack") == 0)
+				cntd->enable_cntd_slack = TRUE;
+			else if(strcasecmp(policy_str, "none") != 0)
+				cntd->enable_cntd = TRUE;
+			cntd->enable_eam_freq = cntd->enable_cntd || cntd->enable_cntd_slack;
+		}
+	}
+
+	// Classes of MPI functions to instrument
+	char *instrument_str = getenv("CNTD_INSTRUMENT");
+	if(instrument_str != NULL)
+	{
+		cntd->instrument_mask = parse_mpi_class_list(instrument_str);
+		if(cntd->instrument_mask < 0)
+		{
+			fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> The option '%s' is not available for CNTD_INSTRUMENT parameter\n",
+				hostname, world_rank, instrument_str);
+			PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+		}
+	}
+	else
+		cntd->instrument_mask = MPI_CLASS_ALL;
+
+	// Sampled accounting rate, globally or per MPI class
+	char *sampled_accounting_str = getenv("CNTD_SAMPLED_ACCOUNTING");
+	for(i = 0; i < NUM_MPI_CLASS; i++)
+		cntd->account_rate[i] = 1;
+	if(sampled_accounting_str != NULL)
+	{
+		if(parse_account_rate(sampled_accounting_str, cntd->account_rate) < 0)
+		{
+			fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> The option '%s' is not available for CNTD_SAMPLED_ACCOUNTING parameter\n",
+				hostname, world_rank, sampled_accounting_str);
+			PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+		}
+	}
+	cntd->enable_sampled_accounting = FALSE;
+	for(i = 0; i < NUM_MPI_CLASS; i++)
+		if(cntd->account_rate[i] > 1)
+			cntd->enable_sampled_accounting = TRUE;
+
+	// Random instead of strided sampled accounting
+	char *sampled_random_str = getenv("CNTD_SAMPLED_RANDOM");
+	if(str_to_bool(sampled_random_str))
+		cntd->enable_sampled_random = TRUE;
+	else
+		cntd->enable_sampled_random = FALSE;
+
 	// Set maximum p-state
 	char *max_pstate_str = getenv("CNTD_MAX_PSTATE");
 	if(max_pstate_str != NULL)
@@ -105,6 +253,77 @@ static void read_env()
 	else
 		cntd->user_pstate[MIN] = NO_CONF;
 
+	// Uncore p-state of the sockets whose ranks are all waiting in MPI
+	char *uncore_pstate_str = getenv("CNTD_UNCORE_PSTATE");
+	if(uncore_pstate_str != NULL)
+	{
+		cntd->enable_uncore = TRUE;
+		cntd->uncore_pstate = strtoul(uncore_pstate_str, 0L, 10);
+	}
+	else
+		cntd->enable_uncore = FALSE;
+
+	// Package power limit of the sockets whose ranks are waiting in MPI
+	char *power_cap_str = getenv("CNTD_POWER_CAP");
+	if(power_cap_str != NULL)
+	{
+		cntd->enable_power_cap = TRUE;
+		cntd->power_cap = strtoul(power_cap_str, 0L, 10);
+	}
+	else
+		cntd->enable_power_cap = FALSE;
+
+	// Percentage of the ranks of a socket waiting in MPI to lower its power limit
+	char *power_cap_threshold_str = getenv("CNTD_POWER_CAP_THRESHOLD");
+	if(power_cap_threshold_str != NULL)
+		cntd->power_cap_threshold = strtoul(power_cap_threshold_str, 0L, 10);
+	else
+		cntd->power_cap_threshold = DEFAULT_POWER_CAP_THRESHOLD;
+	if(cntd->power_cap_threshold == 0 || cntd->power_cap_threshold > 100)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> CNTD_POWER_CAP_THRESHOLD must be a percentage: %s\n",
+			hostname, world_rank, power_cap_threshold_str);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	// Time the ranks must have been waiting in MPI to lower the power limit
+	char *power_cap_hold_str = getenv("CNTD_POWER_CAP_HOLD");
+	if(power_cap_hold_str != NULL)
+		cntd->power_cap_hold = (double) strtoul(power_cap_hold_str, 0L, 10) / 1.0E6;
+	else
+		cntd->power_cap_hold = DEFAULT_POWER_CAP_HOLD;
+	if(cntd->power_cap_hold <= 0)
+		cntd->power_cap_hold = DEFAULT_POWER_CAP_HOLD;
+
+	// Lower the frequency of the compute phases of the ranks with slack
+	char *cntd_imbalance = getenv("CNTD_IMBALANCE");
+	if(str_to_bool(cntd_imbalance))
+		cntd->enable_imbalance = TRUE;
+	else
+		cntd->enable_imbalance = FALSE;
+
+	// Blocking collectives on MPI_COMM_WORLD between two exchanges of the slack
+	char *imbalance_period_str = getenv("CNTD_IMBALANCE_PERIOD");
+	if(imbalance_period_str != NULL)
+		cntd->imbalance_period = strtoul(imbalance_period_str, 0L, 10);
+	else
+		cntd->imbalance_period = DEFAULT_IMBALANCE_PERIOD;
+	if(cntd->imbalance_period == 0)
+		cntd->imbalance_period = DEFAULT_IMBALANCE_PERIOD;
+
+	// Percentage of the compute time left as slack to the ranks
+	char *imbalance_guard_str = getenv("CNTD_IMBALANCE_GUARD");
+	if(imbalance_guard_str != NULL)
+		cntd->imbalance_guard = strtoul(imbalance_guard_str, 0L, 10);
+	else
+		cntd->imbalance_guard = DEFAULT_IMBALANCE_GUARD;
+	if(cntd->imbalance_guard > 100)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> CNTD_IMBALANCE_GUARD must be a percentage: %s\n",
+			hostname, world_rank, imbalance_guard_str);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
 	// Force the use of MSR (require root)
 	char *cntd_force_msr = getenv("CNTD_FORCE_MSR");
 	if(str_to_bool(cntd_force_msr))
@@ -119,6 +338,119 @@ static void read_env()
 	else
 		cntd->eam_timeout = DEFAULT_TIMEOUT;
 
+	// P-state ladder of EAM, its first step replaces the timeout
+	char *pstate_ladder_str = getenv("CNTD_PSTATE_LADDER");
+	if(pstate_ladder_str != NULL)
+	{
+		cntd->num_ladder_steps = parse_pstate_ladder(pstate_ladder_str, cntd->ladder_time, cntd->ladder_pstate);
+		if(cntd->num_ladder_steps < 0)
+		{
+			fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> The option '%s' is not available for CNTD_PSTATE_LADDER parameter\n",
+				hostname, world_rank, pstate_ladder_str);
+			PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+		}
+		cntd->eam_timeout = cntd->ladder_time[0];
+	}
+	else
+		cntd->num_ladder_steps = 0;
+
+	// Merge the polling loops of MPI_Test and MPI_Iprobe into single wait episodes
+	char *cntd_poll_detect = getenv("CNTD_POLL_DETECT");
+	if(str_to_bool(cntd_poll_detect))
+		cntd->enable_poll = TRUE;
+	else
+		cntd->enable_poll = FALSE;
+
+	// Max application gap between the calls of a polling episode
+	char *poll_gap_str = getenv("CNTD_POLL_GAP");
+	if(poll_gap_str != NULL)
+		cntd->poll_gap = (double) strtoul(poll_gap_str, 0L, 10) / 1.0E6;
+	else
+		cntd->poll_gap = DEFAULT_POLL_GAP;
+
+	// Use the watchdog thread instead of the interval timer for the EAM timeout
+	char *cntd_enable_watchdog = getenv("CNTD_ENABLE_WATCHDOG");
+	if(str_to_bool(cntd_enable_watchdog))
+		cntd->enable_watchdog = TRUE;
+	else
+		cntd->enable_watchdog = FALSE;
+
+	// Disable the hardware tick counter
+	char *cntd_disable_tsc = getenv("CNTD_DISABLE_TSC");
+	if(str_to_bool(cntd_disable_tsc))
+		cntd->enable_tsc = FALSE;
+	else
+		cntd->enable_tsc = TRUE;
+
+	// Enable the call-site predictor of EAM
+	char *cntd_eam_predict = getenv("CNTD_EAM_PREDICT");
+	if(str_to_bool(cntd_eam_predict))
+		cntd->enable_eam_predict = TRUE;
+	else
+		cntd->enable_eam_predict = FALSE;
+
+	// Choose the EAM timeout of every MPI type online, only for a timer-based policy
+	char *cntd_adaptive_timeout = getenv("CNTD_ADAPTIVE_TIMEOUT");
+	if(str_to_bool(cntd_adaptive_timeout) &&
+		(cntd->enable_cntd || cntd->enable_cntd_slack) && cntd->eam_timeout > 0)
+		cntd->enable_adaptive_timeout = TRUE;
+	else
+		cntd->enable_adaptive_timeout = FALSE;
+
+	// Max percentage of the calls paying a p-state transition without gain
+	char *adaptive_penalty_str = getenv("CNTD_ADAPTIVE_PENALTY");
+	if(adaptive_penalty_str != NULL)
+		cntd->adaptive_penalty = strtoul(adaptive_penalty_str, 0L, 10);
+	else
+		cntd->adaptive_penalty = DEFAULT_ADAPTIVE_PENALTY;
+	if(cntd->adaptive_penalty > 100)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> CNTD_ADAPTIVE_PENALTY must be a percentage: %s\n",
+			hostname, world_rank, adaptive_penalty_str);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	// Enable the tracking of nonblocking requests
+	char *cntd_enable_request = getenv("CNTD_ENABLE_REQUEST_REPORT");
+	if(str_to_bool(cntd_enable_request))
+	{
+		// The requests are completed and freed by the wait, polling and
+		// accessory wrappers, they would be missed by the uninstrumented ones
+		int completion_mask = (1 << MPI_CLASS_WAIT) | (1 << MPI_CLASS_POLLING) | (1 << MPI_CLASS_ACCESSORY);
+		if((cntd->instrument_mask & completion_mask) == completion_mask)
+			cntd->enable_request = TRUE;
+		else
+		{
+			if(world_rank == 0)
+				fprintf(stderr, "Warning: <COUNTDOWN-node:%s-rank:%d> CNTD_ENABLE_REQUEST_REPORT needs the wait, polling and accessory classes instrumented, disabled\n",
+					hostname, world_rank);
+			cntd->enable_request = FALSE;
+		}
+	}
+	else
+		cntd->enable_request = FALSE;
+
+	// Enable the communication matrix
+	char *cntd_enable_matrix = getenv("CNTD_ENABLE_COMM_MATRIX");
+	if(str_to_bool(cntd_enable_matrix))
+		cntd->enable_matrix = TRUE;
+	else
+		cntd->enable_matrix = FALSE;
+
+	// Save also the communication matrix in CSV
+	char *cntd_matrix_csv = getenv("CNTD_COMM_MATRIX_CSV");
+	if(str_to_bool(cntd_matrix_csv))
+		cntd->enable_matrix_csv = TRUE;
+	else
+		cntd->enable_matrix_csv = FALSE;
+
+	// Enable the call-site report
+	char *cntd_enable_callsite = getenv("CNTD_ENABLE_CALLSITE_REPORT");
+	if(str_to_bool(cntd_enable_callsite))
+		cntd->enable_callsite = TRUE;
+	else
+		cntd->enable_callsite = FALSE;
+
 	// Disable hardware monitor
 	char *hw_monitor_str = getenv("CNTD_DISABLE_POWER_MONITOR");
 	if(str_to_bool(hw_monitor_str))
@@ -329,6 +661,8 @@ HIDDEN void send_mosquitto_init(char* topic_ending, time_t time, double payload_
 
 HIDDEN void start_cntd()
 {
+	int i;
+
 	cntd = (CNTD_t *) calloc(1, sizeof(CNTD_t));
 
 	hwp_usage = 0;
@@ -339,6 +673,36 @@ HIDDEN void start_cntd()
 	// Read environment variables
 	read_env();
 
+	// Detect MPI_THREAD_MULTIPLE
+	init_threads();
+
+	// Calibrate the tick counter
+	init_ticks();
+	cntd->eam_timeout_ticks = (uint64_t) (cntd->eam_timeout * tick_freq);
+	cntd->poll_gap_ticks = (uint64_t) (cntd->poll_gap * tick_freq);
+	cntd->thread_fold_ticks = (uint64_t) (THREAD_FOLD_TIME * tick_freq);
+	cntd->power_cap_hold_ticks = (uint64_t) (cntd->power_cap_hold * tick_freq);
+	for(i = 0; i < cntd->num_ladder_steps; i++)
+		cntd->ladder_ticks[i] = (uint64_t) (cntd->ladder_time[i] * tick_freq);
+	init_adaptive_timeout();
+
+	// Build the instrumentation table
+	init_instrument();
+
+	// Init communicator and datatype caches
+	init_mpi_cache();
+
+	// Init call-site table
+	if(cntd->enable_callsite || cntd->enable_eam_predict)
+		init_callsite();
+
+	// Init request table, persistent requests are tracked anyway
+	init_request();
+
+	// Init communication matrix
+	if(cntd->enable_matrix)
+		init_matrix();
+
 	// Init PM
 	if(cntd->enable_eam_freq) {
 		pm_init();
@@ -358,6 +722,18 @@ HIDDEN void start_cntd()
 	// Read P-state configurations
 	init_arch_conf();
 
+	// Init uncore coordination of the sockets
+	if(cntd->enable_uncore)
+		init_uncore();
+
+	// Init power cap controller of the node
+	if(cntd->enable_power_cap)
+		init_power_cap();
+
+	// Init load-imbalance-driven DVFS
+	if(cntd->enable_imbalance)
+		init_imbalance();
+
 #ifdef MOSQUITTO_ENABLED
     time_t start_time;
 	if(cntd->rank->local_rank == 0) {
@@ -453,19 +829,24 @@ HIDDEN void start_cntd()
 		init_timeseries_report();
 
 	// Init energy-aware MPI
-	if(cntd->enable_cntd)
-		eam_init();
-	else if(cntd->enable_cntd_slack)
-		eam_slack_init();
+	init_policy();
 }
 
 HIDDEN void stop_cntd()
 {
+	int i;
+
 	// Finalize energy-aware MPI
-	if(cntd->enable_cntd)
-		eam_finalize();
-	else if(cntd->enable_cntd_slack)
-		eam_slack_finalize();
+	finalize_policy();
+
+	if(cntd->enable_uncore)
+		finalize_uncore();
+
+	if(cntd->enable_power_cap)
+		finalize_power_cap();
+
+	if(cntd->enable_imbalance)
+		finalize_imbalance();
 
 	finalize_time_sample();
 
@@ -530,38 +911,37 @@ HIDDEN void stop_cntd()
 
 	print_final_report();
 
-	if(cntd->enable_timeseries_report)
-		finalize_timeseries_report();
+	if(cntd->enable_report)
+		print_msg_size_report();
+	if(cntd->enable_report && cntd->num_ladder_steps > 0)
+		print_ladder_report();
 
-	finalize_local_masters();
-
-	free(cntd);
-}
+	if(cntd->enable_request)
+		print_request_report();
+	finalize_request();
 
-// This is a prolog function for every intercepted MPI call
-HIDDEN void call_start(MPI_Type_t mpi_type, MPI_Comm comm, int addr)
-{
-	cntd->into_mpi = TRUE;
+	if(cntd->enable_matrix)
+	{
+		print_matrix_report();
+		finalize_matrix();
+	}
 
-	if(cntd->enable_cntd)
-		eam_start_mpi();
-	else if(cntd->enable_cntd_slack)
-		eam_slack_start_mpi(mpi_type, comm, addr);
+	if(cntd->enable_callsite)
+		print_callsite_report();
+	if(cntd->enable_callsite || cntd->enable_eam_predict)
+		finalize_callsite();
 
-	event_sample_start(mpi_type);
-}
+	if(cntd->enable_timeseries_report)
+		finalize_timeseries_report();
 
-// This is a epilogue function for every intercepted MPI call
-HIDDEN void call_end(MPI_Type_t mpi_type, MPI_Comm comm, int addr)
-{
-	int eam_flag = FALSE;
+	finalize_local_masters();
 
-	if(cntd->enable_cntd)
-		eam_flag = eam_end_mpi();
-	else if(cntd->enable_cntd_slack)
-		eam_flag = eam_slack_end_mpi(mpi_type, comm, addr);
+	finalize_instrument();
 
-	event_sample_end(mpi_type, eam_flag);
+	finalize_mpi_cache();
 
-	cntd->into_mpi = FALSE;
+	pthread_key_delete(cntd->thread_key);
+	for(i = 0; i < MAX_NUM_THREADS; i++)
+		free(cntd->threads[i].counters);
+	free(cntd);
 }
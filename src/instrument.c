@@ -0,0 +1,374 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+HIDDEN uint8_t mpi_type_instr[NUM_MPI_TYPE];
+HIDDEN uint8_t mpi_type_class[NUM_MPI_TYPE];
+HIDDEN uint32_t mpi_type_rate[NUM_MPI_TYPE];
+
+static int get_mpi_class(MPI_Type_t mpi_type)
+{
+	switch(mpi_type)
+	{
+		case __MPI_ALLGATHER:
+		case __MPI_IALLGATHER:
+		case __MPI_ALLGATHERV:
+		case __MPI_IALLGATHERV:
+		case __MPI_ALLREDUCE:
+		case __MPI_IALLREDUCE:
+		case __MPI_ALLTOALL:
+		case __MPI_IALLTOALL:
+		case __MPI_ALLTOALLV:
+		case __MPI_IALLTOALLV:
+		case __MPI_ALLTOALLW:
+		case __MPI_IALLTOALLW:
+		case __MPI_BARRIER:
+		case __MPI_IBARRIER:
+		case __MPI_BCAST:
+		case __MPI_IBCAST:
+		case __MPI_EXSCAN:
+		case __MPI_IEXSCAN:
+		case __MPI_GATHER:
+		case __MPI_IGATHER:
+		case __MPI_GATHERV:
+		case __MPI_IGATHERV:
+		case __MPI_REDUCE:
+		case __MPI_IREDUCE:
+		case __MPI_REDUCE_SCATTER:
+		case __MPI_IREDUCE_SCATTER:
+		case __MPI_REDUCE_SCATTER_BLOCK:
+		case __MPI_IREDUCE_SCATTER_BLOCK:
+		case __MPI_SCAN:
+		case __MPI_ISCAN:
+		case __MPI_SCATTER:
+		case __MPI_ISCATTER:
+		case __MPI_SCATTERV:
+		case __MPI_ISCATTERV:
+		case __MPI_NEIGHBOR_ALLGATHER:
+		case __MPI_INEIGHBOR_ALLGATHER:
+		case __MPI_NEIGHBOR_ALLGATHERV:
+		case __MPI_INEIGHBOR_ALLGATHERV:
+		case __MPI_NEIGHBOR_ALLTOALL:
+		case __MPI_INEIGHBOR_ALLTOALL:
+		case __MPI_NEIGHBOR_ALLTOALLV:
+		case __MPI_INEIGHBOR_ALLTOALLV:
+		case __MPI_NEIGHBOR_ALLTOALLW:
+		case __MPI_INEIGHBOR_ALLTOALLW:
+		case __MPI_ALLGATHER_INIT:
+		case __MPI_ALLGATHERV_INIT:
+		case __MPI_ALLREDUCE_INIT:
+		case __MPI_ALLTOALL_INIT:
+		case __MPI_ALLTOALLV_INIT:
+		case __MPI_ALLTOALLW_INIT:
+		case __MPI_BARRIER_INIT:
+		case __MPI_BCAST_INIT:
+		case __MPI_EXSCAN_INIT:
+		case __MPI_GATHER_INIT:
+		case __MPI_GATHERV_INIT:
+		case __MPI_NEIGHBOR_ALLGATHER_INIT:
+		case __MPI_NEIGHBOR_ALLGATHERV_INIT:
+		case __MPI_NEIGHBOR_ALLTOALL_INIT:
+		case __MPI_NEIGHBOR_ALLTOALLV_INIT:
+		case __MPI_NEIGHBOR_ALLTOALLW_INIT:
+		case __MPI_REDUCE_INIT:
+		case __MPI_REDUCE_SCATTER_INIT:
+		case __MPI_REDUCE_SCATTER_BLOCK_INIT:
+		case __MPI_SCAN_INIT:
+		case __MPI_SCATTER_INIT:
+		case __MPI_SCATTERV_INIT:
+		case __MPI_CART_CREATE:
+		case __MPI_CART_SUB:
+		case __MPI_COMM_CREATE:
+		case __MPI_COMM_CREATE_GROUP:
+		case __MPI_COMM_DUP:
+		case __MPI_COMM_DUP_WITH_INFO:
+		case __MPI_COMM_IDUP:
+		case __MPI_COMM_SPLIT:
+		case __MPI_COMM_SPLIT_TYPE:
+		case __MPI_DIST_GRAPH_CREATE:
+		case __MPI_DIST_GRAPH_CREATE_ADJACENT:
+		case __MPI_GRAPH_CREATE:
+		case __MPI_INTERCOMM_CREATE:
+		case __MPI_INTERCOMM_MERGE:
+		case __MPI_CART_CREATE__BARRIER:
+		case __MPI_COMM_CREATE__BARRIER:
+		case __MPI_COMM_SPLIT__BARRIER:
+		case __MPI_ALLGATHER__BARRIER:
+		case __MPI_ALLGATHERV__BARRIER:
+		case __MPI_ALLREDUCE__BARRIER:
+		case __MPI_ALLTOALL__BARRIER:
+		case __MPI_ALLTOALLV__BARRIER:
+		case __MPI_ALLTOALLW__BARRIER:
+		case __MPI_BCAST__BARRIER:
+		case __MPI_EXSCAN__BARRIER:
+		case __MPI_SCAN__BARRIER:
+		case __MPI_GATHER__BARRIER:
+		case __MPI_GATHERV__BARRIER:
+		case __MPI_REDUCE__BARRIER:
+		case __MPI_REDUCE_SCATTER__BARRIER:
+		case __MPI_SCATTER__BARRIER:
+		case __MPI_SCATTERV__BARRIER:
+		case __MPI_NEIGHBOR_ALLGATHER__BARRIER:
+		case __MPI_NEIGHBOR_ALLGATHERV__BARRIER:
+		case __MPI_NEIGHBOR_ALLTOALL__BARRIER:
+		case __MPI_NEIGHBOR_ALLTOALLV__BARRIER:
+		case __MPI_NEIGHBOR_ALLTOALLW__BARRIER:
+			return MPI_CLASS_COLLECTIVE;
+		case __MPI_SEND:
+		case __MPI_SSEND:
+		case __MPI_BSEND:
+		case __MPI_RSEND:
+		case __MPI_RECV:
+		case __MPI_SENDRECV:
+		case __MPI_SENDRECV_REPLACE:
+		case __MPI_ISEND:
+		case __MPI_ISSEND:
+		case __MPI_IBSEND:
+		case __MPI_IRSEND:
+		case __MPI_IRECV:
+		case __MPI_MRECV:
+		case __MPI_IMRECV:
+		case __MPI_SEND_INIT:
+		case __MPI_SSEND_INIT:
+		case __MPI_BSEND_INIT:
+		case __MPI_RSEND_INIT:
+		case __MPI_RECV_INIT:
+		case __MPI_PSEND_INIT:
+		case __MPI_PRECV_INIT:
+		case __MPI_PREADY:
+		case __MPI_PREADY_RANGE:
+		case __MPI_PREADY_LIST:
+		case __MPI_START:
+		case __MPI_STARTALL:
+		case __MPI_SEND__BARRIER:
+		case __MPI_SSEND__BARRIER:
+		case __MPI_BSEND__BARRIER:
+		case __MPI_RSEND__BARRIER:
+		case __MPI_RECV__BARRIER:
+		case __MPI_SENDRECV__BARRIER:
+		case __MPI_SENDRECV_REPLACE__BARRIER:
+			return MPI_CLASS_P2P;
+		case __MPI_WAIT:
+		case __MPI_WAITALL:
+		case __MPI_WAITANY:
+		case __MPI_WAITSOME:
+		case __MPI_PROBE:
+		case __MPI_MPROBE:
+		case __MPI_PROBE__BARRIER:
+			return MPI_CLASS_WAIT;
+		case __MPI_TEST:
+		case __MPI_TESTALL:
+		case __MPI_TESTANY:
+		case __MPI_TESTSOME:
+		case __MPI_IPROBE:
+		case __MPI_PARRIVED:
+		case __MPI_IMPROBE:
+		case __MPI_REQUEST_GET_STATUS:
+		case __MPI_WIN_TEST:
+		case __MPI_POLL_EPISODE:
+			return MPI_CLASS_POLLING;
+		case __MPI_ACCUMULATE:
+		case __MPI_RACCUMULATE:
+		case __MPI_COMPARE_AND_SWAP:
+		case __MPI_FETCH_AND_OP:
+		case __MPI_GET:
+		case __MPI_RGET:
+		case __MPI_GET_ACCUMULATE:
+		case __MPI_RGET_ACCUMULATE:
+		case __MPI_PUT:
+		case __MPI_RPUT:
+		case __MPI_WIN_ALLOCATE:
+		case __MPI_WIN_ALLOCATE_SHARED:
+		case __MPI_WIN_CREATE:
+		case __MPI_WIN_CREATE_DYNAMIC:
+		case __MPI_WIN_FREE:
+		case __MPI_WIN_ATTACH:
+		case __MPI_WIN_DETACH:
+		case __MPI_WIN_FENCE:
+		case __MPI_WIN_POST:
+		case __MPI_WIN_START:
+		case __MPI_WIN_COMPLETE:
+		case __MPI_WIN_WAIT:
+		case __MPI_WIN_LOCK:
+		case __MPI_WIN_LOCK_ALL:
+		case __MPI_WIN_UNLOCK:
+		case __MPI_WIN_UNLOCK_ALL:
+		case __MPI_WIN_FLUSH:
+		case __MPI_WIN_FLUSH_ALL:
+		case __MPI_WIN_FLUSH_LOCAL:
+		case __MPI_WIN_FLUSH_LOCAL_ALL:
+		case __MPI_WIN_SYNC:
+			return MPI_CLASS_RMA;
+		case __MPI_FILE_OPEN:
+		case __MPI_FILE_CLOSE:
+		case __MPI_FILE_DELETE:
+		case __MPI_FILE_SET_SIZE:
+		case __MPI_FILE_PREALLOCATE:
+		case __MPI_FILE_SET_VIEW:
+		case __MPI_FILE_READ_AT:
+		case __MPI_FILE_READ_AT_ALL:
+		case __MPI_FILE_WRITE_AT:
+		case __MPI_FILE_WRITE_AT_ALL:
+		case __MPI_FILE_IREAD_AT:
+		case __MPI_FILE_IWRITE_AT:
+		case __MPI_FILE_IREAD_AT_ALL:
+		case __MPI_FILE_IWRITE_AT_ALL:
+		case __MPI_FILE_READ:
+		case __MPI_FILE_READ_ALL:
+		case __MPI_FILE_WRITE:
+		case __MPI_FILE_WRITE_ALL:
+		case __MPI_FILE_IREAD:
+		case __MPI_FILE_IWRITE:
+		case __MPI_FILE_IREAD_ALL:
+		case __MPI_FILE_IWRITE_ALL:
+		case __MPI_FILE_SEEK:
+		case __MPI_FILE_READ_SHARED:
+		case __MPI_FILE_WRITE_SHARED:
+		case __MPI_FILE_IREAD_SHARED:
+		case __MPI_FILE_IWRITE_SHARED:
+		case __MPI_FILE_READ_ORDERED:
+		case __MPI_FILE_WRITE_ORDERED:
+		case __MPI_FILE_SEEK_SHARED:
+		case __MPI_FILE_READ_AT_ALL_BEGIN:
+		case __MPI_FILE_READ_AT_ALL_END:
+		case __MPI_FILE_WRITE_AT_ALL_BEGIN:
+		case __MPI_FILE_WRITE_AT_ALL_END:
+		case __MPI_FILE_READ_ALL_BEGIN:
+		case __MPI_FILE_READ_ALL_END:
+		case __MPI_FILE_WRITE_ALL_BEGIN:
+		case __MPI_FILE_WRITE_ALL_END:
+		case __MPI_FILE_READ_ORDERED_BEGIN:
+		case __MPI_FILE_READ_ORDERED_END:
+		case __MPI_FILE_WRITE_ORDERED_BEGIN:
+		case __MPI_FILE_WRITE_ORDERED_END:
+		case __MPI_FILE_SYNC:
+			return MPI_CLASS_IO;
+		default:
+			return MPI_CLASS_ACCESSORY;
+	}
+}
+
+// Parse a comma-separated list of MPI classes, return the class mask or -1
+HIDDEN int parse_mpi_class_list(const char str[])
+{
+	int i, mask = 0;
+	char list[STRING_SIZE];
+	char *token, *saveptr;
+
+	strncpy(list, str, STRING_SIZE - 1);
+	list[STRING_SIZE - 1] = '\0';
+
+	for(token = strtok_r(list, ",", &saveptr); token != NULL; token = strtok_r(NULL, ",", &saveptr))
+	{
+		if(strcasecmp(token, "all") == 0)
+		{
+			mask |= MPI_CLASS_ALL;
+			continue;
+		}
+		for(i = 0; i < NUM_MPI_CLASS; i++)
+		{
+			if(strcasecmp(token, mpi_class_str[i]) == 0)
+			{
+				mask |= (1 << i);
+				break;
+			}
+		}
+		if(i == NUM_MPI_CLASS)
+			return -1;
+	}
+	return mask;
+}
+
+// Parse a comma-separated list of sampling rates, either a number for all
+// the MPI classes or class:number, return -1 on error
+HIDDEN int parse_account_rate(const char str[], uint32_t rate[])
+{
+	int i, mask;
+	unsigned long value;
+	char list[STRING_SIZE];
+	char *token, *sep, *end, *saveptr;
+
+	strncpy(list, str, STRING_SIZE - 1);
+	list[STRING_SIZE - 1] = '\0';
+
+	for(token = strtok_r(list, ",", &saveptr); token != NULL; token = strtok_r(NULL, ",", &saveptr))
+	{
+		sep = strchr(token, ':');
+		if(sep != NULL)
+		{
+			*sep = '\0';
+			mask = parse_mpi_class_list(token);
+			if(mask < 0)
+				return -1;
+			sep++;
+		}
+		else
+		{
+			mask = MPI_CLASS_ALL;
+			sep = token;
+		}
+
+		value = strtoul(sep, &end, 10);
+		if(end == sep || *end != '\0' || value < 1 || value > UINT32_MAX / 2)
+			return -1;
+
+		for(i = 0; i < NUM_MPI_CLASS; i++)
+			if((mask >> i) & 1)
+				rate[i] = (uint32_t) value;
+	}
+	return 0;
+}
+
+HIDDEN void init_instrument()
+{
+	int i;
+
+	for(i = 0; i < NUM_MPI_TYPE; i++)
+	{
+		mpi_type_class[i] = get_mpi_class(i);
+		mpi_type_instr[i] = (cntd->instrument_mask >> mpi_type_class[i]) & 1;
+		mpi_type_rate[i] = cntd->account_rate[mpi_type_class[i]];
+	}
+
+	// Initialization and finalization are always tracked
+	mpi_type_instr[__MPI_INIT] = TRUE;
+	mpi_type_instr[__MPI_INIT_THREAD] = TRUE;
+	mpi_type_instr[__MPI_FINALIZE] = TRUE;
+	mpi_type_rate[__MPI_INIT] = 1;
+	mpi_type_rate[__MPI_INIT_THREAD] = 1;
+	mpi_type_rate[__MPI_FINALIZE] = 1;
+}
+
+HIDDEN void finalize_instrument()
+{
+	// After finalization every wrapper forwards directly to PMPI
+	memset(mpi_type_instr, 0, sizeof(mpi_type_instr));
+}
@@ -0,0 +1,404 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+// Sparse communication matrix of the rank: lock-free open-addressing tables
+// of the point-to-point traffic per peer and of the collective traffic per
+// communicator. A slot is claimed by a CAS on its key and never released
+// until finalize.
+static CNTD_MatrixCounter_t *peer_table = NULL;
+static unsigned int peer_table_size = 0;
+static CNTD_MatrixCounter_t comm_table[MATRIX_COMM_TABLE_SIZE];
+static uint64_t matrix_dropped = 0;
+
+static inline unsigned int hash_matrix(uint64_t key, unsigned int size)
+{
+	return (unsigned int) ((key * 0x9E3779B97F4A7C15ULL) >> 32) & (size - 1);
+}
+
+static CNTD_MatrixCounter_t* get_counter(CNTD_MatrixCounter_t *table, unsigned int size, uint64_t key)
+{
+	unsigned int i;
+	uint64_t curr_key;
+	unsigned int h = hash_matrix(key, size);
+
+	for(i = 0; i < size; i++)
+	{
+		CNTD_MatrixCounter_t *entry = &table[h];
+
+		curr_key = __atomic_load_n(&entry->key, __ATOMIC_ACQUIRE);
+		if(curr_key == key)
+			return entry;
+		if(curr_key == 0)
+		{
+			if(__atomic_compare_exchange_n(&entry->key, &curr_key, key,
+				FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+				return entry;
+			// Another thread claimed the slot, it may be for the same key
+			if(curr_key == key)
+				return entry;
+		}
+		h = (h + 1) & (size - 1);
+	}
+
+	__atomic_fetch_add(&matrix_dropped, 1, __ATOMIC_RELAXED);
+	return NULL;
+}
+
+HIDDEN void add_matrix_p2p(MPI_Comm comm, int dest, uint64_t data)
+{
+	int peer = get_world_rank(comm, dest);
+
+	// MPI_PROC_NULL or a rank out of MPI_COMM_WORLD
+	if(peer >= 0)
+		add_matrix_peer(peer, data);
+}
+
+// Traffic toward the world rank peer
+HIDDEN void add_matrix_peer(int peer, uint64_t data)
+{
+	CNTD_MatrixCounter_t *entry;
+
+	// Scaled by the weight of the call under sampled accounting
+	entry = get_counter(peer_table, peer_table_size, (uint64_t) peer + 1);
+	if(entry != NULL)
+	{
+		add_counter(&entry->bytes, data * cntd_thread.weight);
+		add_counter(&entry->cnt, cntd_thread.weight);
+	}
+}
+
+// Communicators are identified across ranks by the hash of the world ranks
+// of their group, so duplicates of the same group share a line
+HIDDEN void add_matrix_coll(MPI_Comm comm, uint64_t data)
+{
+	CNTD_MatrixCounter_t *entry;
+	uint64_t group_id;
+	int leader = get_world_rank(comm, 0);
+
+	if(leader < 0)
+		return;
+	group_id = get_comm_group_id(comm);
+	if(group_id == 0)
+		return;
+
+	entry = get_counter(comm_table, MATRIX_COMM_TABLE_SIZE, group_id);
+	if(entry != NULL)
+	{
+		// Written with the same values by every thread claiming the key
+		entry->leader = leader;
+		entry->size = (uint32_t) get_comm_size(comm);
+		add_counter(&entry->bytes, data * cntd_thread.weight);
+		add_counter(&entry->cnt, cntd_thread.weight);
+	}
+}
+
+static int compare_entry(const void *a, const void *b)
+{
+	const CNTD_MatrixEntry_t *x = (const CNTD_MatrixEntry_t *) a;
+	const CNTD_MatrixEntry_t *y = (const CNTD_MatrixEntry_t *) b;
+
+	if(x->src != y->src)
+		return x->src < y->src ? -1 : 1;
+	if(x->dst != y->dst)
+		return x->dst < y->dst ? -1 : 1;
+	return 0;
+}
+
+// Communicators by leader and size, the same group on consecutive lines
+static int compare_counter(const void *a, const void *b)
+{
+	const CNTD_MatrixCounter_t *x = (const CNTD_MatrixCounter_t *) a;
+	const CNTD_MatrixCounter_t *y = (const CNTD_MatrixCounter_t *) b;
+
+	if(x->leader != y->leader)
+		return x->leader < y->leader ? -1 : 1;
+	if(x->size != y->size)
+		return x->size < y->size ? -1 : 1;
+	if(x->key != y->key)
+		return x->key < y->key ? -1 : 1;
+	return 0;
+}
+
+static void* alloc_matrix(size_t size)
+{
+	void *buf = malloc(size > 0 ? size : 1);
+
+	if(buf == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the communication matrix\n",
+			cntd->node.hostname, cntd->rank->world_rank);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+	return buf;
+}
+
+static FILE* open_matrix_file(const char *name, const char *mode)
+{
+	char filename[STRING_SIZE];
+
+	snprintf(filename, STRING_SIZE, "%s/%s", cntd->log_dir, name);
+	FILE *fd = fopen(filename, mode);
+	if(fd == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to create the communication matrix report: %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, filename);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+	return fd;
+}
+
+static void open_matrix_mpi_file(const char *name, MPI_File *fh)
+{
+	char filename[STRING_SIZE];
+
+	snprintf(filename, STRING_SIZE, "%s/%s", cntd->log_dir, name);
+	if(PMPI_File_open(MPI_COMM_WORLD, filename, MPI_MODE_CREATE | MPI_MODE_WRONLY,
+		MPI_INFO_NULL, fh) != MPI_SUCCESS)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to create the communication matrix report: %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, filename);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+	// Drop the content of a previous run
+	PMPI_File_set_size(*fh, 0);
+}
+
+// Write the header from rank 0 and the rows of every rank after it in rank
+// order, at the offset given by the exclusive prefix sum of the row sizes.
+// Rows larger than MATRIX_WRITE_CHUNK are written in several rounds, joined
+// by all the ranks as the write is collective.
+static void write_matrix_rows(MPI_File fh, const void *header, int header_size, const void *buf, uint64_t size)
+{
+	uint64_t i, offset = 0, max_size, num_rounds, written = 0;
+	int chunk;
+
+	PMPI_Exscan(&size, &offset, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+	// The result of the exclusive scan is undefined on rank 0
+	if(cntd->rank->world_rank == 0)
+	{
+		offset = 0;
+		PMPI_File_write_at(fh, 0, (void *) header, header_size, MPI_BYTE, MPI_STATUS_IGNORE);
+	}
+	offset += header_size;
+
+	PMPI_Allreduce(&size, &max_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+	num_rounds = (max_size + MATRIX_WRITE_CHUNK - 1) / MATRIX_WRITE_CHUNK;
+	for(i = 0; i < num_rounds; i++)
+	{
+		chunk = (int) (size - written > MATRIX_WRITE_CHUNK ? MATRIX_WRITE_CHUNK : size - written);
+		PMPI_File_write_at_all(fh, (MPI_Offset) (offset + written), (char *) buf + written,
+			chunk, MPI_BYTE, MPI_STATUS_IGNORE);
+		written += chunk;
+	}
+}
+
+// Gather the variable-size arrays of all ranks on rank 0. The counts are in
+// elements of a contiguous datatype, NULL if they overflow an int anyway.
+static void* gather_matrix(void *local, int num, size_t elem_size, int world_size, int *total)
+{
+	int i;
+	int64_t num64 = num, total64;
+	int *counts = NULL, *displs = NULL;
+	void *buf = NULL;
+	MPI_Datatype elem_type;
+
+	PMPI_Allreduce(&num64, &total64, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+	if(total64 > INT_MAX)
+	{
+		if(cntd->rank->world_rank == 0)
+			fprintf(stderr, "Warning: <COUNTDOWN-node:%s-rank:%d> %ld communication matrix counters, too many to gather\n",
+				cntd->node.hostname, cntd->rank->world_rank, total64);
+		*total = 0;
+		return NULL;
+	}
+	*total = (int) total64;
+
+	PMPI_Type_contiguous((int) elem_size, MPI_BYTE, &elem_type);
+	PMPI_Type_commit(&elem_type);
+
+	if(cntd->rank->world_rank == 0)
+	{
+		counts = (int *) alloc_matrix(world_size * sizeof(int));
+		displs = (int *) alloc_matrix(world_size * sizeof(int));
+		buf = alloc_matrix(*total * elem_size);
+	}
+
+	PMPI_Gather(&num, 1, MPI_INT, counts, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+	if(cntd->rank->world_rank == 0)
+	{
+		displs[0] = 0;
+		for(i = 1; i < world_size; i++)
+			displs[i] = displs[i - 1] + counts[i - 1];
+	}
+
+	PMPI_Gatherv(local, num, elem_type, buf, counts, displs, elem_type, 0, MPI_COMM_WORLD);
+
+	PMPI_Type_free(&elem_type);
+	free(counts);
+	free(displs);
+	return buf;
+}
+
+HIDDEN void print_matrix_report()
+{
+	unsigned int i;
+	int j, world_size, num_peers = 0, num_comms = 0, num_coll, num_ranks;
+	char header[MATRIX_HEADER_SIZE];
+	int32_t sizes[2];
+	char *rows;
+	uint64_t num_peers64, nnz, dropped, rows_size = 0;
+	CNTD_MatrixEntry_t *local_entries;
+	CNTD_MatrixCounter_t local_comms[MATRIX_COMM_TABLE_SIZE], *comms;
+	MPI_File fh;
+	FILE *fd;
+
+	PMPI_Comm_size(MPI_COMM_WORLD, &world_size);
+
+	// Row of this rank, sorted on the destination
+	local_entries = (CNTD_MatrixEntry_t *) alloc_matrix(peer_table_size * sizeof(CNTD_MatrixEntry_t));
+	for(i = 0; i < peer_table_size; i++)
+	{
+		if(peer_table[i].key == 0)
+			continue;
+		local_entries[num_peers].src = cntd->rank->world_rank;
+		local_entries[num_peers].dst = (int32_t) (peer_table[i].key - 1);
+		local_entries[num_peers].bytes = peer_table[i].bytes;
+		local_entries[num_peers].msgs = peer_table[i].cnt;
+		num_peers++;
+	}
+	qsort(local_entries, num_peers, sizeof(CNTD_MatrixEntry_t), compare_entry);
+
+	num_peers64 = num_peers;
+	PMPI_Allreduce(&num_peers64, &nnz, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+
+	// Binary COO: magic, world size, entry size, number of nonzeros, entries.
+	// Rows are written in rank order, so the entries are sorted as in CSR.
+	sizes[0] = world_size;
+	sizes[1] = sizeof(CNTD_MatrixEntry_t);
+	memcpy(header, MATRIX_MAGIC, strlen(MATRIX_MAGIC));
+	memcpy(header + strlen(MATRIX_MAGIC), sizes, sizeof(sizes));
+	memcpy(header + strlen(MATRIX_MAGIC) + sizeof(sizes), &nnz, sizeof(nnz));
+	open_matrix_mpi_file(MATRIX_REPORT_FILE, &fh);
+	write_matrix_rows(fh, header, MATRIX_HEADER_SIZE, local_entries,
+		(uint64_t) num_peers * sizeof(CNTD_MatrixEntry_t));
+	PMPI_File_close(&fh);
+
+	if(cntd->enable_matrix_csv)
+	{
+		const char *labels = "src_rank;dst_rank;data;number\n";
+
+		rows = (char *) alloc_matrix((size_t) num_peers * MATRIX_CSV_LINE_SIZE);
+		for(j = 0; j < num_peers; j++)
+			rows_size += snprintf(rows + rows_size, MATRIX_CSV_LINE_SIZE, "%d;%d;%lu;%lu\n",
+				local_entries[j].src,
+				local_entries[j].dst,
+				local_entries[j].bytes,
+				local_entries[j].msgs);
+		open_matrix_mpi_file(MATRIX_CSV_REPORT_FILE, &fh);
+		write_matrix_rows(fh, labels, strlen(labels), rows, rows_size);
+		PMPI_File_close(&fh);
+		free(rows);
+	}
+	free(local_entries);
+
+	for(i = 0; i < MATRIX_COMM_TABLE_SIZE; i++)
+		if(comm_table[i].key != 0)
+			local_comms[num_comms++] = comm_table[i];
+
+	comms = (CNTD_MatrixCounter_t *) gather_matrix(local_comms, num_comms,
+		sizeof(CNTD_MatrixCounter_t), world_size, &num_coll);
+	PMPI_Reduce(&matrix_dropped, &dropped, 1, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+
+	if(cntd->rank->world_rank != 0)
+		return;
+
+	if(dropped > 0)
+		fprintf(stderr, "Warning: <COUNTDOWN-node:%s-rank:%d> Communication matrix full, %lu updates not tracked\n",
+			cntd->node.hostname, cntd->rank->world_rank, dropped);
+
+	if(comms == NULL)
+		return;
+
+	// One line per communicator, merging the counters of its ranks
+	qsort(comms, num_coll, sizeof(CNTD_MatrixCounter_t), compare_counter);
+	fd = open_matrix_file(MATRIX_COLL_REPORT_FILE, "w");
+	fprintf(fd, "leader_rank;comm_size;num_ranks;number;data\n");
+	for(j = 0; j < num_coll; j += num_ranks)
+	{
+		uint64_t bytes = 0, cnt = 0;
+
+		for(num_ranks = 0; j + num_ranks < num_coll && comms[j + num_ranks].key == comms[j].key; num_ranks++)
+		{
+			bytes += comms[j + num_ranks].bytes;
+			cnt += comms[j + num_ranks].cnt;
+		}
+		fprintf(fd, "%d;%u;%d;%lu;%lu\n",
+			comms[j].leader,
+			comms[j].size,
+			num_ranks,
+			cnt,
+			bytes);
+	}
+	fclose(fd);
+
+	free(comms);
+}
+
+HIDDEN void init_matrix()
+{
+	int world_size;
+
+	PMPI_Comm_size(MPI_COMM_WORLD, &world_size);
+
+	// Twice the world size keeps the probe sequences short with all peers
+	peer_table_size = MATRIX_MIN_TABLE_SIZE;
+	while(peer_table_size < MATRIX_MAX_TABLE_SIZE && peer_table_size < 2 * (unsigned int) world_size)
+		peer_table_size <<= 1;
+
+	peer_table = (CNTD_MatrixCounter_t *) calloc(peer_table_size, sizeof(CNTD_MatrixCounter_t));
+	if(peer_table == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the communication matrix\n",
+			cntd->node.hostname, cntd->rank->world_rank);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+	memset(comm_table, 0, sizeof(comm_table));
+	matrix_dropped = 0;
+}
+
+HIDDEN void finalize_matrix()
+{
+	free(peer_table);
+	peer_table = NULL;
+	peer_table_size = 0;
+}
@@ -132,7 +132,10 @@ HIDDEN void set_max_pstate()
 //	}
 //#endif
 
-	if(cntd->user_pstate[MAX] != NO_CONF)
+	// Ranks with slack at the collectives compute at a lower p-state
+	if(imbalance_pstate != NO_CONF)
+		set_pstate(imbalance_pstate);
+	else if(cntd->user_pstate[MAX] != NO_CONF)
 		set_pstate(cntd->user_pstate[MAX]);
 	else {
 		cntd->sys_pstate[MAX] = get_maximum_turbo_frequency();
@@ -155,6 +158,42 @@ HIDDEN void set_min_pstate()
 		set_pstate(cntd->sys_pstate[MIN]);
 }
 
+// Parse the p-state ladder "t1:ps1,t2:ps2,..." with the times in microseconds
+// from the MPI call entry, strictly increasing. Return the number of steps.
+HIDDEN int parse_pstate_ladder(const char str[], double time[], int pstate[])
+{
+	int num_steps = 0;
+	unsigned long usec, value;
+	char list[STRING_SIZE];
+	char *token, *sep, *end, *saveptr;
+
+	strncpy(list, str, STRING_SIZE - 1);
+	list[STRING_SIZE - 1] = '\0';
+
+	for(token = strtok_r(list, ",", &saveptr); token != NULL; token = strtok_r(NULL, ",", &saveptr))
+	{
+		sep = strchr(token, ':');
+		if(sep == NULL || num_steps == MAX_LADDER_STEPS)
+			return -1;
+		*sep = '\0';
+		sep++;
+
+		usec = strtoul(token, &end, 10);
+		if(end == token || *end != '\0' || usec == 0)
+			return -1;
+		value = strtoul(sep, &end, 10);
+		if(end == sep || *end != '\0' || value > INT32_MAX)
+			return -1;
+
+		time[num_steps] = (double) usec / 1.0E6;
+		pstate[num_steps] = (int) value;
+		if(num_steps > 0 && time[num_steps] <= time[num_steps - 1])
+			return -1;
+		num_steps++;
+	}
+	return num_steps > 0 ? num_steps : -1;
+}
+
 HIDDEN int get_maximum_turbo_frequency()
 {
 	int world_rank, max_pstate;
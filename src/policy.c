@@ -0,0 +1,150 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+// Handle of the shared object of an external policy
+static void *policy_handle = NULL;
+static CNTD_PolicyHost_t policy_host;
+
+static void none_enter(int mpi_type, MPI_Comm comm, void *addr)
+{
+}
+
+static int none_exit(int mpi_type, MPI_Comm comm, void *addr)
+{
+	return FALSE;
+}
+
+// Profiling only, the p-state is never changed
+static const CNTD_Policy_t none_policy = {
+	.version = CNTD_POLICY_VERSION,
+	.name = "none",
+	.init = NULL,
+	.on_enter = none_enter,
+	.on_exit = none_exit,
+	.on_sample = NULL,
+	.finalize = NULL};
+
+static uint64_t host_read_ticks()
+{
+	return read_ticks();
+}
+
+static void load_policy(const char path[])
+{
+	CNTD_PolicyRegister_t policy_register;
+
+	policy_host.version = CNTD_POLICY_VERSION;
+	policy_host.world_rank = cntd->rank->world_rank;
+	policy_host.local_rank = cntd->rank->local_rank;
+	policy_host.eam_timeout = cntd->eam_timeout;
+	policy_host.tick_freq = tick_freq;
+	policy_host.mpi_type_class = mpi_type_class;
+	policy_host.mpi_type_str = mpi_type_str;
+	policy_host.mpi_class_str = mpi_class_str;
+	policy_host.read_ticks = host_read_ticks;
+	policy_host.set_pstate = set_pstate;
+	policy_host.set_max_pstate = set_max_pstate;
+	policy_host.set_min_pstate = set_min_pstate;
+	policy_host.lower_pstate = eam_lower_pstate;
+	policy_host.get_epoch = eam_get_epoch;
+	policy_host.restore_pstate = eam_restore_pstate;
+	policy_host.init_timer = init_timer;
+	policy_host.start_timer = start_timer;
+	policy_host.reset_timer = reset_timer;
+	policy_host.finalize_timer = finalize_timer;
+
+	policy_handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+	if(policy_handle == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to load the policy %s: %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, path, dlerror());
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	policy_register = (CNTD_PolicyRegister_t) dlsym(policy_handle, CNTD_POLICY_SYMBOL);
+	if(policy_register == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> The policy %s does not export %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, path, CNTD_POLICY_SYMBOL);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	memset(&cntd->policy, 0, sizeof(CNTD_Policy_t));
+	if(policy_register(&policy_host, &cntd->policy) != 0 ||
+		cntd->policy.version != CNTD_POLICY_VERSION ||
+		cntd->policy.on_enter == NULL || cntd->policy.on_exit == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> The policy %s failed to register (version %d, expected %d)\n",
+			cntd->node.hostname, cntd->rank->world_rank, path, cntd->policy.version, CNTD_POLICY_VERSION);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+	if(cntd->policy.name == NULL)
+		cntd->policy.name = path;
+}
+
+// Select the policy once, the MPI calls only go through its callbacks
+HIDDEN void init_policy()
+{
+	if(cntd->policy_name[0] == '\0')
+	{
+		if(cntd->enable_cntd)
+			cntd->policy = eam_policy;
+		else if(cntd->enable_cntd_slack)
+			cntd->policy = eam_slack_policy;
+		else
+			cntd->policy = none_policy;
+	}
+	else if(strcasecmp(cntd->policy_name, eam_policy.name) == 0)
+		cntd->policy = eam_policy;
+	else if(strcasecmp(cntd->policy_name, eam_slack_policy.name) == 0)
+		cntd->policy = eam_slack_policy;
+	else if(strcasecmp(cntd->policy_name, none_policy.name) == 0)
+		cntd->policy = none_policy;
+	else
+		load_policy(cntd->policy_name);
+
+	if(cntd->policy.init != NULL)
+		cntd->policy.init();
+}
+
+HIDDEN void finalize_policy()
+{
+	if(cntd->policy.finalize != NULL)
+		cntd->policy.finalize();
+	cntd->policy = none_policy;
+
+	if(policy_handle != NULL)
+	{
+		dlclose(policy_handle);
+		policy_handle = NULL;
+	}
+}
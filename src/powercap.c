@@ -0,0 +1,191 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+// Node power capping. The ranks publish in the shared memory the time they
+// entered MPI. A controller thread of the local master lowers the PL1 limit
+// of a socket when at least the threshold percentage of its ranks has been
+// waiting for longer than the hold time, and restores it as soon as the
+// ranks in MPI fall below the threshold.
+static pthread_t power_cap_thread;
+static volatile int power_cap_stop = FALSE;
+static int socket_ranks[MAX_NUM_SOCKETS];
+static int socket_capped[MAX_NUM_SOCKETS];
+#ifdef INTEL
+static uint64_t power_limit_uw[MAX_NUM_SOCKETS];
+static char power_limit_file[MAX_NUM_SOCKETS][STRING_SIZE];
+#endif
+
+static void set_power_limit(int socket_id, int capped)
+{
+	socket_capped[socket_id] = capped;
+	if(!cntd->enable_eam_freq)
+		return;
+
+#ifdef INTEL
+	uint64_t uw = capped ? (uint64_t) cntd->power_cap * 1000000 : power_limit_uw[socket_id];
+
+	if(write_uint64_to_file(power_limit_file[socket_id], uw) < 0)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to write file: %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, power_limit_file[socket_id]);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+#endif
+}
+
+static void *power_cap_loop(void *arg)
+{
+	int i, socket_id;
+	int waiting[MAX_NUM_SOCKETS];
+	int waiting_long[MAX_NUM_SOCKETS];
+	struct timespec ts;
+
+	// Sample the ranks four times per hold time
+	ts.tv_sec = (time_t) (cntd->power_cap_hold / 4);
+	ts.tv_nsec = (long) ((cntd->power_cap_hold / 4 - (double) ts.tv_sec) * 1.0E9);
+
+	while(!power_cap_stop)
+	{
+		uint64_t now = read_ticks();
+
+		memset(waiting, 0, sizeof(waiting));
+		memset(waiting_long, 0, sizeof(waiting_long));
+		for(i = 0; i < cntd->local_rank_size; i++)
+		{
+			uint64_t entry = __atomic_load_n(&cntd->local_ranks[i]->mpi_entry_ticks, __ATOMIC_ACQUIRE);
+			if(entry == 0)
+				continue;
+
+			socket_id = cntd->local_ranks[i]->socket_id;
+			waiting[socket_id]++;
+			if(now > entry && now - entry >= cntd->power_cap_hold_ticks)
+				waiting_long[socket_id]++;
+		}
+
+		for(socket_id = 0; socket_id < MAX_NUM_SOCKETS; socket_id++)
+		{
+			int threshold = (int) cntd->power_cap_threshold * socket_ranks[socket_id];
+
+			if(socket_ranks[socket_id] == 0)
+				continue;
+			if(!socket_capped[socket_id] && waiting_long[socket_id] * 100 >= threshold)
+				set_power_limit(socket_id, TRUE);
+			else if(socket_capped[socket_id] && waiting[socket_id] * 100 < threshold)
+				set_power_limit(socket_id, FALSE);
+		}
+		nanosleep(&ts, NULL);
+	}
+	return NULL;
+}
+
+HIDDEN void init_power_cap()
+{
+	int i;
+	sigset_t set, old_set;
+
+#ifndef INTEL
+	fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Power capping is only supported on Intel processors\n",
+		cntd->node.hostname, cntd->rank->world_rank);
+	PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+#endif
+
+	if(cntd->rank->socket_id < 0 || cntd->rank->socket_id >= MAX_NUM_SOCKETS)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Socket %d exceeds the maximum of %d sockets\n",
+			cntd->node.hostname, cntd->rank->world_rank, cntd->rank->socket_id, MAX_NUM_SOCKETS);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	// Ranks of every socket, the socket ids are published in the shared memory
+	PMPI_Barrier(cntd->comm_local);
+	if(cntd->rank->local_rank != 0)
+		return;
+	for(i = 0; i < cntd->local_rank_size; i++)
+		socket_ranks[cntd->local_ranks[i]->socket_id]++;
+
+#ifdef INTEL
+	// PL1 of the RAPL package domains set by the system, restored when leaving MPI
+	if(cntd->enable_eam_freq)
+	{
+		int socket_id;
+		char filename[STRING_SIZE], filevalue[STRING_SIZE];
+
+		for(i = 0; i < cntd->node.num_sockets; i++)
+		{
+			snprintf(filename, STRING_SIZE, INTEL_RAPL_PKG_NAME, i);
+			if(read_str_from_file(filename, filevalue) < 0 ||
+				sscanf(filevalue, "package-%d", &socket_id) != 1 ||
+				socket_id < 0 || socket_id >= MAX_NUM_SOCKETS)
+			{
+				fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to read the RAPL package domain: %s\n",
+					cntd->node.hostname, cntd->rank->world_rank, filename);
+				PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+			}
+
+			snprintf(power_limit_file[socket_id], STRING_SIZE, PKG_POWER_LIMIT_UW, i);
+			if(read_str_from_file(power_limit_file[socket_id], filevalue) < 0)
+			{
+				fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to read file: %s\n",
+					cntd->node.hostname, cntd->rank->world_rank, power_limit_file[socket_id]);
+				PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+			}
+			power_limit_uw[socket_id] = strtoull(filevalue, NULL, 10);
+		}
+	}
+#endif
+
+	// The controller thread must never receive the signals of the process
+	power_cap_stop = FALSE;
+	sigfillset(&set);
+	pthread_sigmask(SIG_SETMASK, &set, &old_set);
+	if(pthread_create(&power_cap_thread, NULL, power_cap_loop, NULL) != 0)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to create the power cap thread\n",
+			cntd->node.hostname, cntd->rank->world_rank);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+	pthread_sigmask(SIG_SETMASK, &old_set, NULL);
+}
+
+HIDDEN void finalize_power_cap()
+{
+	int socket_id;
+
+	if(cntd->rank->local_rank != 0)
+		return;
+
+	power_cap_stop = TRUE;
+	pthread_join(power_cap_thread, NULL);
+	for(socket_id = 0; socket_id < MAX_NUM_SOCKETS; socket_id++)
+		if(socket_capped[socket_id])
+			set_power_limit(socket_id, FALSE);
+}
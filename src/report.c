@@ -30,6 +30,10 @@
 
 #include "cntd.h"
 
+#ifndef __INTEL_COMPILER
+#include <math.h>
+#endif
+
 static FILE *timeseries_fd;
 
 static void print_rank_mpi(CNTD_RankInfo_t *rankinfo, uint64_t *mpi_type_cnt)
@@ -109,7 +113,7 @@ static void print_rank(CNTD_RankInfo_t *rankinfo, double exe_time)
 	for(j = 0; j < MAX_NUM_CUSTOM_PERF; j++)
 		if(cntd->perf_fd[0][j] > 0)
 			fprintf(fd, ";perf_event_%d", j);
-	fprintf(fd, "\n");
+	fprintf(fd, ";overhead_time;overhead_sampling_time\n");
 
 	// Data
 	for(i = 0; i < world_size; i++)
@@ -132,7 +136,10 @@ static void print_rank(CNTD_RankInfo_t *rankinfo, double exe_time)
 		for(j = 0; j < MAX_NUM_CUSTOM_PERF; j++)
 			if(cntd->perf_fd[0][j] > 0)
 				fprintf(fd, ";%lu", rankinfo[i].perf[j][TOT]);
-		fprintf(fd, "\n");
+		double overhead_time = rankinfo[i].sampling_overhead_time;
+		for(j = 0; j < NUM_MPI_CLASS; j++)
+			overhead_time += rankinfo[i].overhead_time[j];
+		fprintf(fd, ";%.9f;%.9f\n", overhead_time, rankinfo[i].sampling_overhead_time);
 	}
 
 	fclose(fd);
@@ -169,7 +176,19 @@ static void print_mpi_report(uint64_t *mpi_type_cnt, double *mpi_type_time, uint
 	fclose(fd);
 }
 
-static void print_eam_report(uint64_t *cntd_mpi_type_cnt, double *cntd_mpi_type_time)
+static void print_timeout(FILE *fd, double timeout)
+{
+	if(timeout == __builtin_inf())
+		fprintf(fd, ";inf");
+	else
+		fprintf(fd, ";%.9f", timeout);
+}
+
+// With adaptive timeouts, the updates of the timeout of every MPI type, those
+// that found no timeout worth arming, the min, mean and max of the chosen
+// timeouts along the execution and the mean of the last ones over the ranks
+static void print_eam_report(uint64_t *cntd_mpi_type_cnt, double *cntd_mpi_type_time,
+	double (*timeout_stats)[NUM_MPI_TYPE])
 {
 	int i;
 	char filename[STRING_SIZE];
@@ -194,15 +213,37 @@ static void print_eam_report(uint64_t *cntd_mpi_type_cnt, double *cntd_mpi_type_
 	}
 
 	// Labels
-	fprintf(fd, "type;number;time\n");
+	fprintf(fd, "type;number;time");
+	if(timeout_stats != NULL)
+		fprintf(fd, ";timeout_updates;timeout_disabled;timeout_min;timeout_mean;timeout_max;timeout_last");
+	fprintf(fd, "\n");
 
 	// Data
 	for(i = 0; i < NUM_MPI_TYPE; i++)
-		if(cntd_mpi_type_cnt[i] > 0)
-			fprintf(fd, "%s;%lu;%.9f\n",
-				mpi_type_str[i]+2,
-				cntd_mpi_type_cnt[i],
-				cntd_mpi_type_time[i]);
+	{
+		if(cntd_mpi_type_cnt[i] == 0 &&
+			(timeout_stats == NULL || timeout_stats[TIMEOUT_STAT_UPDATES][i] == 0))
+			continue;
+
+		fprintf(fd, "%s;%lu;%.9f",
+			mpi_type_str[i]+2,
+			cntd_mpi_type_cnt[i],
+			cntd_mpi_type_time[i]);
+		if(timeout_stats != NULL)
+		{
+			double armed = timeout_stats[TIMEOUT_STAT_UPDATES][i] - timeout_stats[TIMEOUT_STAT_DISABLED][i];
+			double last_cnt = timeout_stats[TIMEOUT_STAT_LAST_CNT][i];
+
+			fprintf(fd, ";%.0f;%.0f",
+				timeout_stats[TIMEOUT_STAT_UPDATES][i],
+				timeout_stats[TIMEOUT_STAT_DISABLED][i]);
+			print_timeout(fd, timeout_stats[TIMEOUT_STAT_MIN][i]);
+			print_timeout(fd, armed > 0 ? timeout_stats[TIMEOUT_STAT_SUM][i] / armed : __builtin_inf());
+			print_timeout(fd, armed > 0 ? timeout_stats[TIMEOUT_STAT_MAX][i] : __builtin_inf());
+			print_timeout(fd, last_cnt > 0 ? timeout_stats[TIMEOUT_STAT_LAST][i] / last_cnt : __builtin_inf());
+		}
+		fprintf(fd, "\n");
+	}
 
 	fclose(fd);
 }
@@ -226,6 +267,10 @@ HIDDEN void print_final_report()
 	CNTD_GPUInfo_t gpuinfo[local_master_size];
 
 	PMPI_Gather(cntd->rank, 1, cpu_type, rankinfo, 1, cpu_type, 0, MPI_COMM_WORLD);
+
+	double timeout_stats[NUM_TIMEOUT_STATS][NUM_MPI_TYPE];
+	if(cntd->enable_adaptive_timeout)
+		reduce_timeout_stats(&timeout_stats[0][0]);
 	if(cntd->rank->local_rank == 0)
 	{
 		PMPI_Gather(&cntd->node, 1, node_type, nodeinfo, 1, node_type, 0, cntd->comm_local_masters);
@@ -293,6 +338,11 @@ HIDDEN void print_final_report()
 		uint64_t mpi_type_data[2][NUM_MPI_TYPE] = {0};
 		uint64_t cntd_mpi_type_cnt[NUM_MPI_TYPE] = {0};
 		double cntd_mpi_type_time[NUM_MPI_TYPE] = {0};
+		uint64_t overhead_cnt[NUM_MPI_CLASS] = {0};
+		double overhead_time[NUM_MPI_CLASS] = {0};
+		double sampling_overhead_time = 0;
+		double sampled_var_time[NUM_MPI_CLASS] = {0};
+		double sampled_var_data[NUM_MPI_CLASS] = {0};
 		double avg_ipc = 0;
 		double avg_freq = 0;
 		uint64_t global_cycles = 0;
@@ -341,7 +391,17 @@ HIDDEN void print_final_report()
 
 				cntd_mpi_cnt += rankinfo[i].cntd_mpi_type_cnt[j];
 				cntd_mpi_time += rankinfo[i].cntd_mpi_type_time[j];
+
+				overhead_cnt[mpi_type_class[j]] += rankinfo[i].mpi_type_cnt[j];
+			}
+			for(j = 0; j < NUM_MPI_CLASS; j++)
+			{
+				overhead_time[j] += rankinfo[i].overhead_time[j];
+				// The estimates of the ranks are independent
+				sampled_var_time[j] += rankinfo[i].sampled_var_time[j];
+				sampled_var_data[j] += rankinfo[i].sampled_var_data[j];
 			}
+			sampling_overhead_time += rankinfo[i].sampling_overhead_time;
 		}
 		if(perf_flag)
 		{
@@ -425,6 +485,13 @@ HIDDEN void print_final_report()
 				else
 					fprintf(summary_report_fd, ";cntd_slack_impact_cnt;cntd_slack_impact_time");
 			}
+			fprintf(summary_report_fd, ";overhead_time;overhead_sampling_time");
+			for(i = 0; i < NUM_MPI_CLASS; i++)
+				fprintf(summary_report_fd, ";overhead_%s", mpi_class_str[i]);
+			if(cntd->enable_sampled_accounting)
+				for(i = 0; i < NUM_MPI_CLASS; i++)
+					fprintf(summary_report_fd, ";sampled_%s_rate;sampled_%s_time_ci95;sampled_%s_data_ci95",
+						mpi_class_str[i], mpi_class_str[i], mpi_class_str[i]);
 			fprintf(summary_report_fd, "\n");
 		}
 
@@ -755,12 +822,63 @@ HIDDEN void print_final_report()
 				(cntd_impact_time/(app_time+mpi_time))*100.0);
 		}
 
+		double overhead_tot = sampling_overhead_time;
+		printf("################## COUNTDOWN OVERHEAD ################\n");
+		for(j = 0; j < NUM_MPI_CLASS; j++)
+		{
+			overhead_tot += overhead_time[j];
+			if(overhead_cnt[j] > 0)
+				printf("%s: %.6f Sec - %.3f usec/call\n",
+					mpi_class_str[j],
+					overhead_time[j],
+					(overhead_time[j]/overhead_cnt[j])*1.0E6);
+		}
+		printf("sampling: %.6f Sec\n", sampling_overhead_time);
+		printf("TOT: %.6f Sec - %.4f%%\n",
+			overhead_tot,
+			(overhead_tot/(app_time+mpi_time))*100.0);
+
+		// 95% confidence intervals of the estimated time and bytes per class
+		double sampled_time[NUM_MPI_CLASS] = {0};
+		uint64_t sampled_data[NUM_MPI_CLASS] = {0};
+		if(cntd->enable_sampled_accounting)
+		{
+			for(j = 0; j < NUM_MPI_TYPE; j++)
+			{
+				sampled_time[mpi_type_class[j]] += mpi_type_time[j];
+				sampled_data[mpi_type_class[j]] += mpi_type_data[SEND][j] + mpi_type_data[RECV][j];
+			}
+
+			printf("################# SAMPLED ACCOUNTING #################\n");
+			for(j = 0; j < NUM_MPI_CLASS; j++)
+			{
+				if(cntd->account_rate[j] > 1 && overhead_cnt[j] > 0)
+					printf("%s: 1/%u - %.3f +/- %.3f Sec - %lu +/- %.0f Byte\n",
+						mpi_class_str[j],
+						cntd->account_rate[j],
+						sampled_time[j],
+						1.96 * sqrt(sampled_var_time[j]),
+						sampled_data[j],
+						1.96 * sqrt(sampled_var_data[j]));
+			}
+		}
+
 		if(cntd->enable_report)
 		{
 			if(cntd->enable_cntd || cntd->enable_cntd_slack)
 				fprintf(summary_report_fd, ";%lu;%.9f",
 					cntd_impact_cnt, cntd_impact_time);
 
+			fprintf(summary_report_fd, ";%.9f;%.9f", overhead_tot, sampling_overhead_time);
+			for(j = 0; j < NUM_MPI_CLASS; j++)
+				fprintf(summary_report_fd, ";%.9f", overhead_time[j]);
+			if(cntd->enable_sampled_accounting)
+				for(j = 0; j < NUM_MPI_CLASS; j++)
+					fprintf(summary_report_fd, ";%u;%.9f;%.0f",
+						cntd->account_rate[j],
+						1.96 * sqrt(sampled_var_time[j]),
+						1.96 * sqrt(sampled_var_data[j]));
+
 			fprintf(summary_report_fd, "\n");
 			fclose(summary_report_fd);
 
@@ -769,7 +887,8 @@ HIDDEN void print_final_report()
 
 			// print eam report
 			if(cntd->enable_cntd || cntd->enable_cntd_slack)
-				print_eam_report(cntd_mpi_type_cnt, cntd_mpi_type_time);
+				print_eam_report(cntd_mpi_type_cnt, cntd_mpi_type_time,
+					cntd->enable_adaptive_timeout ? timeout_stats : NULL);
 		}
 
 		printf("######################################################\n");
@@ -785,6 +904,211 @@ HIDDEN void print_final_report()
 	PMPI_Barrier(MPI_COMM_WORLD);
 }
 
+HIDDEN void print_msg_size_report()
+{
+	int i, j;
+	char filename[STRING_SIZE];
+	uint64_t *msg_size = NULL;
+	const int num_bins = 2 * NUM_MPI_TYPE * NUM_MSG_SIZE_BINS;
+
+	if(cntd->rank->world_rank == 0)
+	{
+		msg_size = (uint64_t *) malloc(num_bins * sizeof(uint64_t));
+		if(msg_size == NULL)
+		{
+			fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the message-size report\n",
+				cntd->node.hostname, cntd->rank->world_rank);
+			PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+		}
+	}
+
+	PMPI_Reduce(mpi_type_msg_size, msg_size, num_bins, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+
+	if(cntd->rank->world_rank != 0)
+		return;
+
+	// Create file
+	snprintf(filename, STRING_SIZE, "%s/"MSG_SIZE_REPORT_FILE, cntd->log_dir);
+	FILE *fd = fopen(filename, "w");
+	if(fd == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to create the message-size report: %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, filename);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	// Labels
+	fprintf(fd, "type;direction;min_size;max_size;number\n");
+
+	// Data, the bin b holds the sizes in [2^(b-1), 2^b)
+	for(i = 0; i < NUM_MPI_TYPE; i++)
+	{
+		for(j = 0; j < NUM_MSG_SIZE_BINS; j++)
+		{
+			uint64_t min_size = (j == 0) ? 0 : 1ULL << (j - 1);
+			uint64_t send = msg_size[(SEND * NUM_MPI_TYPE + i) * NUM_MSG_SIZE_BINS + j];
+			uint64_t recv = msg_size[(RECV * NUM_MPI_TYPE + i) * NUM_MSG_SIZE_BINS + j];
+			char max_size[STRING_SIZE];
+
+			if(j == 0)
+				snprintf(max_size, STRING_SIZE, "0");
+			else if(j == NUM_MSG_SIZE_BINS - 1)
+				snprintf(max_size, STRING_SIZE, "inf");
+			else
+				snprintf(max_size, STRING_SIZE, "%llu", (1ULL << j) - 1);
+
+			if(send > 0)
+				fprintf(fd, "%s;send;%lu;%s;%lu\n", mpi_type_str[i]+2, min_size, max_size, send);
+			if(recv > 0)
+				fprintf(fd, "%s;recv;%lu;%s;%lu\n", mpi_type_str[i]+2, min_size, max_size, recv);
+		}
+	}
+
+	fclose(fd);
+	free(msg_size);
+}
+
+// Calls of every MPI type that reached each step of the p-state ladder and
+// time spent at the step, summed over the ranks
+HIDDEN void print_ladder_report()
+{
+	int i, j;
+	char filename[STRING_SIZE];
+	const int num_steps = NUM_MPI_TYPE * MAX_LADDER_STEPS;
+	uint64_t *ladder_cnt = NULL;
+	double *ladder_time = NULL;
+	double *rank_time = (double *) malloc(num_steps * sizeof(double));
+
+	if(cntd->rank->world_rank == 0)
+	{
+		ladder_cnt = (uint64_t *) malloc(num_steps * sizeof(uint64_t));
+		ladder_time = (double *) malloc(num_steps * sizeof(double));
+	}
+	if(rank_time == NULL || (cntd->rank->world_rank == 0 && (ladder_cnt == NULL || ladder_time == NULL)))
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the ladder report\n",
+			cntd->node.hostname, cntd->rank->world_rank);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	// The tick frequency can differ between the nodes
+	for(i = 0; i < NUM_MPI_TYPE; i++)
+		for(j = 0; j < MAX_LADDER_STEPS; j++)
+			rank_time[i * MAX_LADDER_STEPS + j] = ticks_to_sec(mpi_type_ladder_ticks[i][j]);
+
+	PMPI_Reduce(mpi_type_ladder_cnt, ladder_cnt, num_steps, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+	PMPI_Reduce(rank_time, ladder_time, num_steps, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+	free(rank_time);
+
+	if(cntd->rank->world_rank != 0)
+		return;
+
+	// Create file
+	snprintf(filename, STRING_SIZE, "%s/"LADDER_REPORT_FILE, cntd->log_dir);
+	FILE *fd = fopen(filename, "w");
+	if(fd == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to create the ladder report: %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, filename);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	// Labels
+	fprintf(fd, "type;step;pstate;number;time\n");
+
+	// Data
+	for(i = 0; i < NUM_MPI_TYPE; i++)
+		for(j = 0; j < cntd->num_ladder_steps; j++)
+			if(ladder_cnt[i * MAX_LADDER_STEPS + j] > 0)
+				fprintf(fd, "%s;%d;%d;%lu;%.9f\n",
+					mpi_type_str[i]+2,
+					j,
+					cntd->ladder_pstate[j],
+					ladder_cnt[i * MAX_LADDER_STEPS + j],
+					ladder_time[i * MAX_LADDER_STEPS + j]);
+
+	fclose(fd);
+	free(ladder_cnt);
+	free(ladder_time);
+}
+
+static int compare_callsite_time(const void *a, const void *b, void *arg)
+{
+	const CNTD_CallSiteReport_t *sites = arg;
+	double x = sites[*(const int *) a].time;
+	double y = sites[*(const int *) b].time;
+
+	return (x < y) - (x > y);
+}
+
+HIDDEN void print_callsite_report()
+{
+	int i, num_sites;
+	char filename[STRING_SIZE];
+	CNTD_CallSiteReport_t *sites;
+
+	num_sites = get_callsite_report(&sites);
+	if(cntd->rank->world_rank != 0)
+		return;
+
+	CNTD_CallSiteName_t *names = (CNTD_CallSiteName_t *) malloc((num_sites + 1) * sizeof(CNTD_CallSiteName_t));
+	int *order = (int *) malloc((num_sites + 1) * sizeof(int));
+	if(names == NULL || order == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the call-site report\n",
+			cntd->node.hostname, cntd->rank->world_rank);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	resolve_callsites(sites, num_sites, names);
+
+	// Most expensive call sites first
+	for(i = 0; i < num_sites; i++)
+		order[i] = i;
+	qsort_r(order, num_sites, sizeof(int), compare_callsite_time, sites);
+
+	// Create file
+	snprintf(filename, STRING_SIZE, "%s/"CALLSITE_REPORT_FILE, cntd->log_dir);
+	FILE *fd = fopen(filename, "w");
+	if(fd == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to create the call-site report: %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, filename);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	// Labels
+	fprintf(fd, "type;function;source;module;offset;num_ranks;number;time;avg_time;min_time;max_time;wait_time;data;eam_number\n");
+
+	// Data
+	for(i = 0; i < num_sites; i++)
+	{
+		CNTD_CallSiteReport_t *site = &sites[order[i]];
+		CNTD_CallSiteName_t *name = &names[order[i]];
+
+		fprintf(fd, "%s;%s;%s;%s;0x%lx;%d;%lu;%.9f;%.9f;%.9f;%.9f;%.9f;%lu;%lu\n",
+			mpi_type_str[site->mpi_type]+2,
+			name->function,
+			name->source,
+			name->module,
+			site->offset,
+			site->num_ranks,
+			site->cnt,
+			site->time,
+			site->time / site->cnt,
+			site->min_time,
+			site->max_time,
+			site->wait_time,
+			site->data,
+			site->eam_cnt);
+	}
+
+	fclose(fd);
+	free(order);
+	free(names);
+	free(sites);
+}
+
 HIDDEN void init_timeseries_report()
 {
 	if(cntd->rank->local_rank == 0)
@@ -0,0 +1,448 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+// Lock-free open-addressing table of the pending nonblocking requests.
+// Completed requests leave a tombstone that the next post can reuse, and
+// the probe sequence is bounded so a table full of tombstones stays fast.
+// Persistent requests are always tracked, as their bytes are accounted at
+// every MPI_Start, the others only with the request report.
+static CNTD_Request_t *request_table = NULL;
+static uint64_t request_dropped = 0;
+
+// Statistics per originating MPI type
+static uint64_t req_cnt[NUM_MPI_TYPE];
+static uint64_t req_data[NUM_MPI_TYPE];
+static uint64_t req_latency_ticks[NUM_MPI_TYPE];
+static uint64_t req_max_latency_ticks[NUM_MPI_TYPE];
+static uint64_t req_wait_ticks[NUM_MPI_TYPE];
+static uint64_t req_eam_ticks[NUM_MPI_TYPE];
+
+static inline uintptr_t request_key(MPI_Request request)
+{
+	return (uintptr_t) request;
+}
+
+static inline unsigned int hash_request(uintptr_t key)
+{
+	return (unsigned int) ((key * 0x9E3779B97F4A7C15ULL) >> 32) & (REQUEST_TABLE_SIZE - 1);
+}
+
+static CNTD_Request_t* find_request(MPI_Request request)
+{
+	int i;
+	uintptr_t curr_key, key = request_key(request);
+	unsigned int h = hash_request(key);
+
+	for(i = 0; i < REQUEST_MAX_PROBE; i++)
+	{
+		CNTD_Request_t *entry = &request_table[h];
+
+		curr_key = __atomic_load_n(&entry->request, __ATOMIC_ACQUIRE);
+		if(curr_key == key)
+			return entry;
+		if(curr_key == 0)
+			return NULL;
+		h = (h + 1) & (REQUEST_TABLE_SIZE - 1);
+	}
+	return NULL;
+}
+
+// Claim a free entry or a tombstone for the key, NULL if the probe fails
+static CNTD_Request_t* claim_request(uintptr_t key)
+{
+	int i;
+	uintptr_t curr_key;
+	unsigned int h = hash_request(key);
+
+	for(i = 0; i < REQUEST_MAX_PROBE; i++)
+	{
+		CNTD_Request_t *entry = &request_table[h];
+
+		curr_key = __atomic_load_n(&entry->request, __ATOMIC_ACQUIRE);
+		if((curr_key == 0 || curr_key == REQUEST_TOMBSTONE) &&
+			__atomic_compare_exchange_n(&entry->request, &curr_key, key,
+				FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			return entry;
+		h = (h + 1) & (REQUEST_TABLE_SIZE - 1);
+	}
+	return NULL;
+}
+
+static void track_request(MPI_Type_t mpi_type, MPI_Request request, int peer, int world_peer, const uint64_t *start_data)
+{
+	CNTD_Request_t *entry;
+	int persistent = (start_data != NULL);
+
+	if((!cntd->enable_request && !persistent) || request == MPI_REQUEST_NULL)
+		return;
+
+	// MPI reuses the handle of a freed request: an entry still keyed on it
+	// was released through an untracked call and is overwritten in place
+	entry = find_request(request);
+	if(entry == NULL)
+		entry = claim_request(request_key(request));
+	if(entry == NULL)
+	{
+		__atomic_fetch_add(&request_dropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
+
+	entry->mpi_type = mpi_type;
+	entry->peer = peer;
+	entry->world_peer = world_peer;
+	entry->persistent = persistent;
+	// Persistent requests are posted by MPI_Start
+	if(persistent)
+	{
+		entry->start_data[SEND] = start_data[SEND];
+		entry->start_data[RECV] = start_data[RECV];
+		entry->data = start_data[SEND] + start_data[RECV];
+		entry->post_ticks = 0;
+	}
+	else
+	{
+		// Scaled estimate under sampled accounting
+		entry->data = cntd_thread.call_data * cntd_thread.weight;
+		entry->post_ticks = read_ticks();
+	}
+	entry->site = cntd_thread.curr_site;
+}
+
+HIDDEN void add_request(MPI_Type_t mpi_type, MPI_Request request, int peer, const uint64_t *start_data)
+{
+	track_request(mpi_type, request, peer, -1, start_data);
+}
+
+HIDDEN void add_request_f(MPI_Type_t mpi_type, MPI_Fint request, int peer, const uint64_t *start_data)
+{
+	if(cntd->enable_request || start_data != NULL)
+		track_request(mpi_type, MPI_Request_f2c(request), peer, -1, start_data);
+}
+
+// Persistent P2P request, the world rank of the peer records every start
+// in the communication matrix
+HIDDEN void add_request_p2p_init(MPI_Type_t mpi_type, MPI_Comm comm, MPI_Request request, int peer, const uint64_t *start_data)
+{
+	int world_peer = cntd->enable_matrix ? get_world_rank(comm, peer) : -1;
+
+	track_request(mpi_type, request, peer, world_peer, start_data);
+}
+
+HIDDEN void add_request_p2p_init_f(MPI_Type_t mpi_type, MPI_Fint comm, MPI_Fint request, int peer, const uint64_t *start_data)
+{
+	add_request_p2p_init(mpi_type, MPI_Comm_f2c(comm), MPI_Request_f2c(request), peer, start_data);
+}
+
+// Account the bytes of the started persistent request to its operation
+static void start_request(MPI_Request request)
+{
+	CNTD_Request_t *entry = find_request(request);
+
+	if(entry != NULL && entry->persistent)
+	{
+		entry->post_ticks = read_ticks();
+		add_start(entry->mpi_type, entry->start_data, entry->world_peer);
+	}
+}
+
+HIDDEN void start_requests(int count, const MPI_Request *requests)
+{
+	int i;
+
+	for(i = 0; i < count; i++)
+		start_request(requests[i]);
+}
+
+HIDDEN void start_requests_f(int count, const MPI_Fint *requests)
+{
+	int i;
+
+	for(i = 0; i < count; i++)
+		start_request(MPI_Request_f2c(requests[i]));
+}
+
+static MPI_Request* get_saved_requests(int count)
+{
+	if(count > cntd_thread.saved_size)
+	{
+		MPI_Request *buf = (MPI_Request *) realloc(cntd_thread.saved_requests, count * sizeof(MPI_Request));
+		if(buf == NULL)
+			return NULL;
+		cntd_thread.saved_requests = buf;
+		cntd_thread.saved_size = count;
+	}
+	return cntd_thread.saved_requests;
+}
+
+// Completed requests are set to MPI_REQUEST_NULL, so the handles must be
+// copied before the completion call
+HIDDEN MPI_Request* save_requests(int count, const MPI_Request *requests)
+{
+	MPI_Request *saved;
+
+	if(!cntd->enable_request || count <= 0)
+		return NULL;
+
+	saved = get_saved_requests(count);
+	if(saved != NULL)
+		memcpy(saved, requests, count * sizeof(MPI_Request));
+	return saved;
+}
+
+HIDDEN MPI_Request* save_requests_f(int count, const MPI_Fint *requests)
+{
+	int i;
+	MPI_Request *saved;
+
+	if(!cntd->enable_request || count <= 0)
+		return NULL;
+
+	saved = get_saved_requests(count);
+	if(saved != NULL)
+		for(i = 0; i < count; i++)
+			saved[i] = MPI_Request_f2c(requests[i]);
+	return saved;
+}
+
+static void complete_request(MPI_Request request, uint64_t now)
+{
+	int i;
+	CNTD_Request_t *entry;
+	MPI_Type_t mpi_type;
+
+	if(request == MPI_REQUEST_NULL)
+		return;
+
+	entry = find_request(request);
+	if(entry == NULL || entry->post_ticks == 0)
+		return;
+
+	mpi_type = entry->mpi_type;
+	uint64_t latency = now > entry->post_ticks ? now - entry->post_ticks : 0;
+	add_counter(&req_cnt[mpi_type], 1);
+	add_counter(&req_data[mpi_type], entry->data);
+	add_counter(&req_latency_ticks[mpi_type], latency);
+	uint64_t curr = __atomic_load_n(&req_max_latency_ticks[mpi_type], __ATOMIC_RELAXED);
+	while(latency > curr &&
+		!__atomic_compare_exchange_n(&req_max_latency_ticks[mpi_type], &curr, latency,
+			TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+	// The time of the completion call is split among the origins in request_end
+	for(i = 0; i < cntd_thread.num_completed; i++)
+	{
+		if(cntd_thread.completed[i].mpi_type == mpi_type && cntd_thread.completed[i].site == entry->site)
+			break;
+	}
+	if(i == cntd_thread.num_completed)
+	{
+		if(i < REQUEST_PENDING_SIZE)
+		{
+			cntd_thread.completed[i].mpi_type = mpi_type;
+			cntd_thread.completed[i].site = entry->site;
+			cntd_thread.completed[i].cnt = 0;
+			cntd_thread.num_completed++;
+		}
+		else
+			i = REQUEST_PENDING_SIZE - 1;
+	}
+	cntd_thread.completed[i].cnt++;
+
+	// Persistent requests stay valid until freed
+	if(entry->persistent)
+		entry->post_ticks = 0;
+	else
+		__atomic_store_n(&entry->request, REQUEST_TOMBSTONE, __ATOMIC_RELEASE);
+}
+
+// Complete the saved requests, all of them or those at the given indices.
+// The base is 1 for the indices returned by the Fortran bindings.
+HIDDEN void complete_requests(int count, const MPI_Request *saved, const int *indices, int base)
+{
+	int i;
+	uint64_t now;
+
+	if(saved == NULL)
+		return;
+
+	now = read_ticks();
+	for(i = 0; i < count; i++)
+	{
+		if(indices == NULL)
+			complete_request(saved[i], now);
+		else if(indices[i] != MPI_UNDEFINED)
+			complete_request(saved[indices[i] - base], now);
+	}
+}
+
+HIDDEN void free_request(MPI_Request request)
+{
+	CNTD_Request_t *entry = find_request(request);
+
+	if(entry != NULL)
+		__atomic_store_n(&entry->request, REQUEST_TOMBSTONE, __ATOMIC_RELEASE);
+}
+
+HIDDEN void free_request_f(MPI_Fint request)
+{
+	free_request(MPI_Request_f2c(request));
+}
+
+// A cancelled request completes without transferring its bytes. Persistent
+// requests stay valid and can be started again.
+HIDDEN void cancel_request(MPI_Request request)
+{
+	CNTD_Request_t *entry = find_request(request);
+
+	if(entry == NULL)
+		return;
+	if(entry->persistent)
+		entry->post_ticks = 0;
+	else
+		__atomic_store_n(&entry->request, REQUEST_TOMBSTONE, __ATOMIC_RELEASE);
+}
+
+HIDDEN void cancel_request_f(MPI_Fint request)
+{
+	cancel_request(MPI_Request_f2c(request));
+}
+
+// Attribute the time of the completion call to the origins of the requests
+HIDDEN void request_end(MPI_Type_t mpi_type, uint64_t mpi_ticks, int eam_flag)
+{
+	int i;
+	unsigned int total = 0;
+	uint64_t eam_ticks = 0;
+	uint64_t timeout_ticks;
+
+	if(cntd_thread.num_completed == 0)
+		return;
+
+	timeout_ticks = get_eam_timeout_ticks(mpi_type);
+	if(eam_flag && mpi_ticks > timeout_ticks)
+		eam_ticks = mpi_ticks - timeout_ticks;
+
+	for(i = 0; i < cntd_thread.num_completed; i++)
+		total += cntd_thread.completed[i].cnt;
+
+	for(i = 0; i < cntd_thread.num_completed; i++)
+	{
+		CNTD_RequestOrigin_t *origin = &cntd_thread.completed[i];
+		uint64_t wait_ticks = mpi_ticks * origin->cnt / total;
+
+		add_counter(&req_wait_ticks[origin->mpi_type], wait_ticks);
+		add_counter(&req_eam_ticks[origin->mpi_type], eam_ticks * origin->cnt / total);
+		if(origin->site != NULL)
+			__atomic_fetch_add(&origin->site->wait_ticks, wait_ticks, __ATOMIC_RELAXED);
+	}
+	cntd_thread.num_completed = 0;
+}
+
+HIDDEN void print_request_report()
+{
+	int i;
+	char filename[STRING_SIZE];
+	uint64_t dropped;
+	uint64_t cnt[NUM_MPI_TYPE], data[NUM_MPI_TYPE];
+	double local_time[4][NUM_MPI_TYPE], time[4][NUM_MPI_TYPE];
+
+	// Convert with the tick frequency of this rank before reducing
+	for(i = 0; i < NUM_MPI_TYPE; i++)
+	{
+		local_time[0][i] = ticks_to_sec(req_latency_ticks[i]);
+		local_time[1][i] = ticks_to_sec(req_wait_ticks[i]);
+		local_time[2][i] = ticks_to_sec(req_eam_ticks[i]);
+		local_time[3][i] = ticks_to_sec(req_max_latency_ticks[i]);
+	}
+
+	PMPI_Reduce(req_cnt, cnt, NUM_MPI_TYPE, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+	PMPI_Reduce(req_data, data, NUM_MPI_TYPE, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+	PMPI_Reduce(local_time, time, 3 * NUM_MPI_TYPE, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+	PMPI_Reduce(local_time[3], time[3], NUM_MPI_TYPE, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+	PMPI_Reduce(&request_dropped, &dropped, 1, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+
+	if(cntd->rank->world_rank != 0)
+		return;
+
+	if(dropped > 0)
+		fprintf(stderr, "Warning: <COUNTDOWN-node:%s-rank:%d> Request table full, %lu requests not tracked\n",
+			cntd->node.hostname, cntd->rank->world_rank, dropped);
+
+	// Create file
+	snprintf(filename, STRING_SIZE, "%s/"REQUEST_REPORT_FILE, cntd->log_dir);
+	FILE *fd = fopen(filename, "w");
+	if(fd == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to create the request report: %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, filename);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+	// Labels
+	fprintf(fd, "type;number;data;wait_time;eam_time;latency;avg_latency;max_latency\n");
+
+	// Data
+	for(i = 0; i < NUM_MPI_TYPE; i++)
+		if(cnt[i] > 0)
+			fprintf(fd, "%s;%lu;%lu;%.9f;%.9f;%.9f;%.9f;%.9f\n",
+				mpi_type_str[i]+2,
+				cnt[i],
+				data[i],
+				time[1][i],
+				time[2][i],
+				time[0][i],
+				time[0][i] / cnt[i],
+				time[3][i]);
+
+	fclose(fd);
+}
+
+HIDDEN void init_request()
+{
+	request_table = (CNTD_Request_t *) calloc(REQUEST_TABLE_SIZE, sizeof(CNTD_Request_t));
+	if(request_table == NULL)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to allocate the request table\n",
+			cntd->node.hostname, cntd->rank->world_rank);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+	request_dropped = 0;
+
+}
+
+HIDDEN void finalize_request()
+{
+	free(request_table);
+	request_table = NULL;
+	free(cntd_thread.saved_requests);
+	cntd_thread.saved_requests = NULL;
+	cntd_thread.saved_size = 0;
+}
@@ -34,7 +34,6 @@
 #include <math.h>
 #endif
 
-static double timing_event_sample[2] = {0};
 
 #ifdef INTEL
 static void read_energy_rapl(uint64_t *energy_pkg, uint64_t *energy_dram)
@@ -328,6 +327,8 @@ HIDDEN void time_sample(int sig, siginfo_t *siginfo, void *context)
 	// initializer is specified.
 	static read_format_t perf[MAX_NUM_CPUS][MAX_NUM_PERF_EVENTS][2];
 
+	uint64_t ticks = read_ticks();
+
     double energy_pkg[MAX_NUM_SOCKETS] = {0};
     double energy_dram[MAX_NUM_SOCKETS] = {0};
 	double energy_gpu_sys[MAX_NUM_SOCKETS] = {0};
@@ -423,11 +424,20 @@ HIDDEN void time_sample(int sig, siginfo_t *siginfo, void *context)
 
 		// Do sample
         timing[curr] = read_time();
+		uint64_t ticks_curr = read_ticks();
 		for(i = 0; i < cntd->local_rank_size; i++)
 		{
-			time_region[i][APP][curr] = cntd->local_ranks[i]->app_time[TOT];
-			time_region[i][MPI][curr] = cntd->local_ranks[i]->mpi_time[TOT];
-			if(cntd->into_mpi)
+			double rank_tick_freq = cntd->local_ranks[i]->tick_freq;
+			time_region[i][APP][curr] = (double) cntd->local_ranks[i]->app_ticks / rank_tick_freq;
+			time_region[i][MPI][curr] = (double) cntd->local_ranks[i]->mpi_ticks / rank_tick_freq;
+			if(cntd->thread_multiple)
+			{
+				// Counters folded by the threads, the phases in progress
+				// are accounted by the next folds
+				cntd->local_ranks[i]->app_time[CURR] = time_region[i][APP][curr] - time_region[i][APP][prev];
+				cntd->local_ranks[i]->mpi_time[CURR] = time_region[i][MPI][curr] - time_region[i][MPI][prev];
+			}
+			else if(cntd->threads_in_mpi > 0)
 			{
 				if(time_region[i][MPI][curr] < time_region[i][MPI][prev])
 				{
@@ -437,7 +447,7 @@ HIDDEN void time_sample(int sig, siginfo_t *siginfo, void *context)
 				}
 				else
 				{
-					time_region[i][MPI][curr] += timing[curr] - timing_event_sample[START];
+					time_region[i][MPI][curr] += ticks_to_sec(ticks_curr - cntd->mpi_ticks_last[START]);
 					cntd->local_ranks[i]->mpi_time[CURR] = time_region[i][MPI][curr] - time_region[i][MPI][prev];
 					cntd->local_ranks[i]->app_time[CURR] = time_region[i][APP][curr] - time_region[i][APP][prev];
 				}
@@ -452,7 +462,7 @@ HIDDEN void time_sample(int sig, siginfo_t *siginfo, void *context)
 				}
 				else
 				{
-					time_region[i][APP][curr] += timing[curr] - timing_event_sample[END];
+					time_region[i][APP][curr] += ticks_to_sec(ticks_curr - cntd->mpi_ticks_last[END]);
 					cntd->local_ranks[i]->app_time[CURR] = time_region[i][APP][curr] - time_region[i][APP][prev];
 					cntd->local_ranks[i]->mpi_time[CURR] = time_region[i][MPI][curr] - time_region[i][MPI][prev];
 				}
@@ -580,6 +590,11 @@ HIDDEN void time_sample(int sig, siginfo_t *siginfo, void *context)
 				util_gpu, util_mem_gpu, temp_gpu, clock_gpu);
 		}
 	}
+
+	if(cntd->policy.on_sample != NULL)
+		cntd->policy.on_sample();
+
+	cntd->rank->sampling_overhead_ticks += read_ticks() - ticks;
 }
 
 HIDDEN void init_time_sample()
@@ -613,6 +628,15 @@ HIDDEN void init_time_sample()
 
 HIDDEN void finalize_time_sample()
 {
+	int i;
+
+	// The other threads are done with MPI, their counters are complete
+	if(cntd->thread_multiple)
+		for(i = 0; i < MAX_NUM_THREADS; i++)
+			if(cntd->threads[i].counters != NULL)
+				fold_thread_counters(cntd->threads[i].counters);
+	PMPI_Barrier(cntd->comm_local);
+
 	if(cntd->rank->local_rank == 0)
 	{
 		// Delete sampling timer
@@ -638,6 +662,9 @@ HIDDEN void finalize_time_sample()
 			finalize_perf();
 	}
 
+	// Tick counters to seconds
+	convert_ticks();
+
 	// Memory usage
 	struct rusage r_usage;
 	getrusage(RUSAGE_SELF, &r_usage);
@@ -646,44 +673,148 @@ HIDDEN void finalize_time_sample()
 	PMPI_Barrier(MPI_COMM_WORLD);
 }
 
+// The entry and exit timestamps are per thread, the first MPI call of a
+// thread has no application phase to account
 HIDDEN void event_sample_start(MPI_Type_t mpi_type)
 {
-	timing_event_sample[START] = read_time();
+	cntd_thread.ticks[START] = read_ticks();
+	if(!cntd->thread_multiple)
+		cntd->mpi_ticks_last[START] = cntd_thread.ticks[START];
 
 	if(mpi_type == __MPI_INIT || mpi_type == __MPI_INIT_THREAD) {
-		cntd->rank->exe_time[START] = timing_event_sample[START];
+		cntd->rank->exe_time[START] = read_time();
 		cntd->rank->exe_is_started = 1;
 	}
-	else
-		cntd->rank->app_time[TOT] += timing_event_sample[START] - timing_event_sample[END];
+	else if(cntd_thread.ticks[END] > 0)
+		CALL_COUNTER(app_ticks) += cntd_thread.ticks[START] - cntd_thread.ticks[END];
 }
 
-HIDDEN void event_sample_end(MPI_Type_t mpi_type, int eam_flag)
+HIDDEN uint64_t event_sample_end(MPI_Type_t mpi_type, int eam_flag)
 {
-	timing_event_sample[END] = read_time();
+	cntd_thread.ticks[END] = read_ticks();
+	if(!cntd->thread_multiple)
+		cntd->mpi_ticks_last[END] = cntd_thread.ticks[END];
 
-	double mpi_time = timing_event_sample[END] - timing_event_sample[START];
-	cntd->rank->mpi_time[TOT] += mpi_time;
-	cntd->rank->mpi_type_time[mpi_type] += mpi_time;
-	cntd->rank->mpi_type_cnt[mpi_type]++;
+	uint64_t mpi_ticks = cntd_thread.ticks[END] - cntd_thread.ticks[START];
+	uint64_t weight = cntd_thread.weight;
+	CALL_COUNTER(mpi_ticks) += mpi_ticks;
 
-	if(cntd->enable_cntd && eam_flag)
+	// Only the total MPI time is exact under sampled accounting, the
+	// sampled calls are scaled by their weight
+	if(weight > 0)
 	{
-		if(mpi_time > cntd->eam_timeout)
+		touch_call_counters(mpi_type);
+		CALL_COUNTER(mpi_type_ticks[mpi_type]) += mpi_ticks * weight;
+		CALL_COUNTER(mpi_type_cnt[mpi_type]) += weight;
+
+		if((cntd->enable_cntd || cntd->enable_cntd_slack) && eam_flag)
 		{
-			cntd->rank->cntd_mpi_type_time [mpi_type] += mpi_time - cntd->eam_timeout;
-			cntd->rank->cntd_mpi_type_cnt[mpi_type]++;
+			uint64_t timeout_ticks = get_eam_timeout_ticks(mpi_type);
+			if(mpi_ticks > timeout_ticks)
+			{
+				CALL_COUNTER(cntd_mpi_type_ticks[mpi_type]) += (mpi_ticks - timeout_ticks) * weight;
+				CALL_COUNTER(cntd_mpi_type_cnt[mpi_type]) += weight;
+			}
+		}
+
+		// Variance of the Horvitz-Thompson estimator with inclusion probability 1/weight
+		if(weight > 1)
+		{
+			double var_weight = (double) weight * (double) (weight - 1);
+			CALL_COUNTER(sampled_var_ticks[mpi_type_class[mpi_type]]) +=
+				var_weight * (double) mpi_ticks * (double) mpi_ticks;
+			CALL_COUNTER(sampled_var_data[mpi_type_class[mpi_type]]) +=
+				var_weight * (double) cntd_thread.call_data * (double) cntd_thread.call_data;
 		}
 	}
-	else if(cntd->enable_cntd_slack && eam_flag)
+
+	if(mpi_type == __MPI_FINALIZE)
+		cntd->rank->exe_time[END] = read_time();
+
+	return mpi_ticks;
+}
+
+// Add the counters of a thread to the rank record and clear them, called by
+// the thread owning them or once the other threads are done with MPI
+HIDDEN void fold_thread_counters(CNTD_ThreadCounters_t *counters)
+{
+	int i, j, dir;
+	uint64_t dirty;
+
+	add_counter(&cntd->rank->app_ticks, counters->app_ticks);
+	add_counter(&cntd->rank->mpi_ticks, counters->mpi_ticks);
+	counters->app_ticks = 0;
+	counters->mpi_ticks = 0;
+
+	for(dir = 0; dir < 2; dir++)
+	{
+		if(counters->mpi_net_data[dir][TOT] > 0)
+			add_counter(&cntd->rank->mpi_net_data[dir][TOT], counters->mpi_net_data[dir][TOT]);
+		if(counters->mpi_file_data[dir][TOT] > 0)
+			add_counter(&cntd->rank->mpi_file_data[dir][TOT], counters->mpi_file_data[dir][TOT]);
+		counters->mpi_net_data[dir][TOT] = 0;
+		counters->mpi_file_data[dir][TOT] = 0;
+	}
+
+	for(i = 0; i < NUM_MPI_CLASS; i++)
 	{
-		if(mpi_time > cntd->eam_timeout)
+		if(counters->overhead_ticks[i] > 0)
+			add_counter(&cntd->rank->overhead_ticks[i], counters->overhead_ticks[i]);
+		if(counters->sampled_var_ticks[i] > 0 || counters->sampled_var_data[i] > 0)
 		{
-			cntd->rank->cntd_mpi_type_time[mpi_type] += mpi_time - cntd->eam_timeout;
-			cntd->rank->cntd_mpi_type_cnt[mpi_type]++;
+			add_double_counter(&cntd->rank->sampled_var_ticks[i], counters->sampled_var_ticks[i]);
+			add_double_counter(&cntd->rank->sampled_var_data[i], counters->sampled_var_data[i]);
 		}
+		counters->overhead_ticks[i] = 0;
+		counters->sampled_var_ticks[i] = 0;
+		counters->sampled_var_data[i] = 0;
 	}
 
-	if(mpi_type == __MPI_FINALIZE)
-		cntd->rank->exe_time[END] = timing_event_sample[END];
+	for(i = 0; i < (NUM_MPI_TYPE + 63) / 64; i++)
+	{
+		for(dirty = counters->dirty[i]; dirty != 0; dirty &= dirty - 1)
+		{
+			j = i * 64 + __builtin_ctzll(dirty);
+
+			add_counter(&cntd->rank->mpi_type_ticks[j], counters->mpi_type_ticks[j]);
+			add_counter(&cntd->rank->mpi_type_cnt[j], counters->mpi_type_cnt[j]);
+			counters->mpi_type_ticks[j] = 0;
+			counters->mpi_type_cnt[j] = 0;
+			if(counters->cntd_mpi_type_cnt[j] > 0)
+			{
+				add_counter(&cntd->rank->cntd_mpi_type_ticks[j], counters->cntd_mpi_type_ticks[j]);
+				add_counter(&cntd->rank->cntd_mpi_type_cnt[j], counters->cntd_mpi_type_cnt[j]);
+				counters->cntd_mpi_type_ticks[j] = 0;
+				counters->cntd_mpi_type_cnt[j] = 0;
+			}
+			for(dir = 0; dir < 2; dir++)
+			{
+				if(counters->mpi_type_data[dir][j] > 0)
+					add_counter(&cntd->rank->mpi_type_data[dir][j], counters->mpi_type_data[dir][j]);
+				counters->mpi_type_data[dir][j] = 0;
+			}
+		}
+		counters->dirty[i] = 0;
+	}
+
+	counters->fold_ticks = read_ticks();
+}
+
+// Convert the tick counters of the rank to seconds for the final report
+HIDDEN void convert_ticks()
+{
+	int i;
+
+	cntd->rank->app_time[TOT] = ticks_to_sec(cntd->rank->app_ticks);
+	cntd->rank->mpi_time[TOT] = ticks_to_sec(cntd->rank->mpi_ticks);
+	for(i = 0; i < NUM_MPI_TYPE; i++)
+	{
+		cntd->rank->mpi_type_time[i] = ticks_to_sec(cntd->rank->mpi_type_ticks[i]);
+		cntd->rank->cntd_mpi_type_time[i] = ticks_to_sec(cntd->rank->cntd_mpi_type_ticks[i]);
+	}
+	for(i = 0; i < NUM_MPI_CLASS; i++)
+		cntd->rank->overhead_time[i] = ticks_to_sec(cntd->rank->overhead_ticks[i]);
+	cntd->rank->sampling_overhead_time = ticks_to_sec(cntd->rank->sampling_overhead_ticks);
+	for(i = 0; i < NUM_MPI_CLASS; i++)
+		cntd->rank->sampled_var_time[i] = cntd->rank->sampled_var_ticks[i] / (tick_freq * tick_freq);
 }
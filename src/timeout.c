@@ -0,0 +1,179 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+// Adaptive EAM timeout. The durations of the calls of every MPI type feed a
+// log-linear histogram, halved at every update to follow the phases of the
+// application. The timeout of the type is the shortest one for which at most
+// CNTD_ADAPTIVE_PENALTY percent of the calls pay a p-state transition without
+// gain, i.e. leave MPI less than CNTD_TIMEOUT after the timeout expired.
+// Shorter timeouts spend less time at high frequency in the long calls.
+HIDDEN uint64_t mpi_type_timeout_ticks[NUM_MPI_TYPE];
+
+static uint64_t timeout_hist[NUM_MPI_TYPE][NUM_TIMEOUT_BINS];
+static uint64_t timeout_calls[NUM_MPI_TYPE];
+static unsigned int timeout_min_bin;
+
+// Evolution of the timeouts of the rank, in seconds
+static double timeout_stats[NUM_TIMEOUT_STATS][NUM_MPI_TYPE];
+
+static unsigned int get_timeout_bin(uint64_t ticks)
+{
+	unsigned int msb, bin;
+
+	if(ticks < (1ULL << TIMEOUT_MIN_SHIFT))
+		return 0;
+
+	msb = 63 - __builtin_clzll(ticks);
+	bin = ((msb - TIMEOUT_MIN_SHIFT) << TIMEOUT_SUB_SHIFT) +
+		((ticks >> (msb - TIMEOUT_SUB_SHIFT)) & ((1 << TIMEOUT_SUB_SHIFT) - 1)) + 1;
+	if(bin >= NUM_TIMEOUT_BINS)
+		bin = NUM_TIMEOUT_BINS - 1;
+	return bin;
+}
+
+// Shortest duration of the bin
+static uint64_t get_bin_ticks(unsigned int bin)
+{
+	unsigned int msb, sub;
+
+	if(bin == 0)
+		return 0;
+
+	msb = TIMEOUT_MIN_SHIFT + ((bin - 1) >> TIMEOUT_SUB_SHIFT);
+	sub = (bin - 1) & ((1 << TIMEOUT_SUB_SHIFT) - 1);
+	return ((uint64_t) ((1 << TIMEOUT_SUB_SHIFT) + sub)) << (msb - TIMEOUT_SUB_SHIFT);
+}
+
+static void update_stats(MPI_Type_t mpi_type, uint64_t timeout_ticks)
+{
+	double timeout;
+
+	timeout_stats[TIMEOUT_STAT_UPDATES][mpi_type]++;
+	if(timeout_ticks == EAM_TIMEOUT_NEVER)
+	{
+		timeout_stats[TIMEOUT_STAT_DISABLED][mpi_type]++;
+		timeout_stats[TIMEOUT_STAT_LAST][mpi_type] = 0;
+		timeout_stats[TIMEOUT_STAT_LAST_CNT][mpi_type] = 0;
+		return;
+	}
+
+	timeout = ticks_to_sec(timeout_ticks);
+	timeout_stats[TIMEOUT_STAT_SUM][mpi_type] += timeout;
+	timeout_stats[TIMEOUT_STAT_LAST][mpi_type] = timeout;
+	timeout_stats[TIMEOUT_STAT_LAST_CNT][mpi_type] = 1;
+	if(timeout < timeout_stats[TIMEOUT_STAT_MIN][mpi_type])
+		timeout_stats[TIMEOUT_STAT_MIN][mpi_type] = timeout;
+	if(timeout > timeout_stats[TIMEOUT_STAT_MAX][mpi_type])
+		timeout_stats[TIMEOUT_STAT_MAX][mpi_type] = timeout;
+}
+
+static void update_timeout(MPI_Type_t mpi_type)
+{
+	unsigned int i;
+	uint64_t cum[NUM_TIMEOUT_BINS + 1];
+	uint64_t max_penalized;
+	uint64_t timeout_ticks = EAM_TIMEOUT_NEVER;
+	uint64_t *hist = timeout_hist[mpi_type];
+
+	// Cumulative histogram, then halve the bins to forget the older calls
+	cum[0] = 0;
+	for(i = 0; i < NUM_TIMEOUT_BINS; i++)
+	{
+		uint64_t cnt = __atomic_load_n(&hist[i], __ATOMIC_RELAXED);
+		cum[i + 1] = cum[i] + cnt;
+		__atomic_store_n(&hist[i], cnt >> 1, __ATOMIC_RELAXED);
+	}
+	max_penalized = cum[NUM_TIMEOUT_BINS] * cntd->adaptive_penalty / 100;
+
+	// The calls of the bins in [timeout, timeout + CNTD_TIMEOUT) are lowered
+	// too late to gain; no timeout is armed when no call is longer
+	for(i = timeout_min_bin; i < NUM_TIMEOUT_BINS; i++)
+	{
+		uint64_t ticks = get_bin_ticks(i);
+		unsigned int end = get_timeout_bin(ticks + cntd->eam_timeout_ticks);
+
+		if(cum[NUM_TIMEOUT_BINS] == cum[i])
+			break;
+		if(cum[end] - cum[i] <= max_penalized)
+		{
+			timeout_ticks = ticks;
+			break;
+		}
+	}
+
+	__atomic_store_n(&mpi_type_timeout_ticks[mpi_type], timeout_ticks, __ATOMIC_RELAXED);
+	update_stats(mpi_type, timeout_ticks);
+}
+
+HIDDEN void add_timeout_sample(MPI_Type_t mpi_type, uint64_t ticks)
+{
+	uint64_t calls;
+
+	add_counter(&timeout_hist[mpi_type][get_timeout_bin(ticks)], 1);
+
+	if(cntd->thread_multiple)
+		calls = __atomic_add_fetch(&timeout_calls[mpi_type], 1, __ATOMIC_RELAXED);
+	else
+		calls = ++timeout_calls[mpi_type];
+	if(calls % TIMEOUT_UPDATE_PERIOD == 0)
+		update_timeout(mpi_type);
+}
+
+// All the MPI types start from CNTD_TIMEOUT
+HIDDEN void init_adaptive_timeout()
+{
+	int i;
+
+	for(i = 0; i < NUM_MPI_TYPE; i++)
+	{
+		mpi_type_timeout_ticks[i] = cntd->eam_timeout_ticks;
+		timeout_stats[TIMEOUT_STAT_MIN][i] = __builtin_inf();
+	}
+
+	timeout_min_bin = get_timeout_bin((uint64_t) (MIN_ADAPTIVE_TIMEOUT * tick_freq));
+	if(get_bin_ticks(timeout_min_bin) < (uint64_t) (MIN_ADAPTIVE_TIMEOUT * tick_freq))
+		timeout_min_bin++;
+}
+
+// Statistics of all the ranks on rank 0, the tick frequency can differ
+// between the nodes so they are reduced in seconds
+HIDDEN void reduce_timeout_stats(double *stats)
+{
+	const int sum_stats = TIMEOUT_STAT_LAST_CNT + 1;
+
+	PMPI_Reduce(timeout_stats, stats, sum_stats * NUM_MPI_TYPE,
+		MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+	PMPI_Reduce(timeout_stats[TIMEOUT_STAT_MIN], stats + TIMEOUT_STAT_MIN * NUM_MPI_TYPE, NUM_MPI_TYPE,
+		MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
+	PMPI_Reduce(timeout_stats[TIMEOUT_STAT_MAX], stats + TIMEOUT_STAT_MAX * NUM_MPI_TYPE, NUM_MPI_TYPE,
+		MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+}
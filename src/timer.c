@@ -30,29 +30,207 @@
 
 #include "cntd.h"
 
+// Watchdog engine: the rank publishes the time it entered MPI together with
+// a sequence number, a helper thread lowers the p-state once the deadline has
+// passed. The state word encodes (sequence << 2 | FIRED | ARMED).
+#define WATCHDOG_ARMED      1
+#define WATCHDOG_FIRED      2
+#define WATCHDOG_SEQ        4
+
+// Deadline the watchdog thread sleeps until while nothing is armed
+#define WATCHDOG_IDLE       UINT64_MAX
+
+static void (*watchdog_callback)();
+static pthread_t watchdog_thread;
+static volatile int watchdog_stop = FALSE;
+static volatile uint64_t watchdog_deadline;
+static volatile uint64_t watchdog_rearm = 0;
+static uint64_t watchdog_seq = 0;
+static uint64_t watchdog_state = 0;
+static uint64_t watchdog_done = 0;
+
+// The watchdog thread blocks on a futex, the rank bumps the futex word and
+// wakes it only when the new deadline is earlier than the one it sleeps to
+static uint64_t watchdog_sleep_until = WATCHDOG_IDLE;
+static uint32_t watchdog_futex = 0;
+
+static void watchdog_wait(uint32_t futex_val, uint64_t ticks)
+{
+    struct timespec ts, *timeout = NULL;
+
+    if(ticks != WATCHDOG_IDLE)
+    {
+        double interval = ticks_to_sec(ticks);
+        ts.tv_sec = (time_t) interval;
+        ts.tv_nsec = (long) ((interval - (double) ts.tv_sec) * 1.0E9);
+        timeout = &ts;
+    }
+    // Returns at once if the word has changed since futex_val was read
+    syscall(__NR_futex, &watchdog_futex, FUTEX_WAIT_PRIVATE, futex_val, timeout, NULL, 0);
+}
+
+static void watchdog_wake()
+{
+    __atomic_add_fetch(&watchdog_futex, 1, __ATOMIC_SEQ_CST);
+    syscall(__NR_futex, &watchdog_futex, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+static void *watchdog_loop(void *arg)
+{
+    while(!watchdog_stop)
+    {
+        uint32_t futex_val = __atomic_load_n(&watchdog_futex, __ATOMIC_SEQ_CST);
+        uint64_t state = __atomic_load_n(&watchdog_state, __ATOMIC_SEQ_CST);
+        uint64_t deadline = watchdog_deadline;
+        uint64_t now = read_ticks();
+
+        if((state & WATCHDOG_ARMED) && !(state & WATCHDOG_FIRED) && now >= deadline)
+        {
+            // Fire only if the rank is still inside the same MPI call
+            if(__atomic_compare_exchange_n(&watchdog_state, &state, state | WATCHDOG_FIRED,
+                FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                uint64_t fired = state | WATCHDOG_FIRED;
+
+                watchdog_rearm = 0;
+                watchdog_callback();
+
+                // Armed again by the callback, unless the rank is leaving MPI
+                if(watchdog_rearm > 0)
+                {
+                    watchdog_deadline = read_ticks() + watchdog_rearm;
+                    if(__atomic_compare_exchange_n(&watchdog_state, &fired, state,
+                        FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+                        continue;
+                }
+                __atomic_store_n(&watchdog_done, state, __ATOMIC_RELEASE);
+            }
+            continue;
+        }
+
+        // Sleep until the deadline while armed, block otherwise. Publishing
+        // the deadline before checking the state again pairs with the rank
+        // storing the state before reading it, so no arm is missed.
+        if(!(state & WATCHDOG_ARMED) || (state & WATCHDOG_FIRED))
+            deadline = WATCHDOG_IDLE;
+        __atomic_store_n(&watchdog_sleep_until, deadline, __ATOMIC_SEQ_CST);
+        if(__atomic_load_n(&watchdog_state, __ATOMIC_SEQ_CST) != state)
+            continue;
+        watchdog_wait(futex_val, deadline == WATCHDOG_IDLE ? WATCHDOG_IDLE : deadline - now);
+    }
+    return NULL;
+}
+
+static void start_watchdog(uint64_t timeout_ticks)
+{
+    uint64_t seq = __atomic_add_fetch(&watchdog_seq, WATCHDOG_SEQ, __ATOMIC_RELAXED);
+    uint64_t deadline = read_ticks() + timeout_ticks;
+
+    watchdog_deadline = deadline;
+    __atomic_store_n(&watchdog_state, seq | WATCHDOG_ARMED, __ATOMIC_SEQ_CST);
+    if(__atomic_load_n(&watchdog_sleep_until, __ATOMIC_SEQ_CST) > deadline)
+        watchdog_wake();
+}
+
+static void reset_watchdog()
+{
+    uint64_t state = __atomic_exchange_n(&watchdog_state,
+        __atomic_load_n(&watchdog_seq, __ATOMIC_RELAXED), __ATOMIC_ACQ_REL);
+
+    // Wait until the callback has completed, the caller restores the p-state
+    if(state & WATCHDOG_FIRED)
+    {
+        state &= ~WATCHDOG_FIRED;
+        while(__atomic_load_n(&watchdog_done, __ATOMIC_ACQUIRE) != state)
+            cpu_relax();
+    }
+}
+
+static void init_watchdog(void (*callback)())
+{
+    sigset_t set, old_set;
+
+    watchdog_callback = callback;
+    watchdog_stop = FALSE;
+
+    // The watchdog thread must never receive the signals of the process
+    sigfillset(&set);
+    pthread_sigmask(SIG_SETMASK, &set, &old_set);
+    if(pthread_create(&watchdog_thread, NULL, watchdog_loop, NULL) != 0)
+    {
+        fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to create the watchdog thread\n",
+            cntd->node.hostname, cntd->rank->world_rank);
+        PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
+    pthread_sigmask(SIG_SETMASK, &old_set, NULL);
+}
+
+static void finalize_watchdog()
+{
+    reset_watchdog();
+    watchdog_stop = TRUE;
+    watchdog_wake();
+    pthread_join(watchdog_thread, NULL);
+}
+
+// Arm the timeout of the rank, the adaptive timeouts differ per MPI type
+HIDDEN void start_timer_ticks(uint64_t timeout_ticks)
+{
+    if(cntd->enable_watchdog)
+        start_watchdog(timeout_ticks);
+    else
+    {
+        struct itimerval timer = {0};
+        double timeout = ticks_to_sec(timeout_ticks);
+        timer.it_value.tv_sec = (time_t) timeout;
+        timer.it_value.tv_usec = (suseconds_t) ((timeout - (double) timer.it_value.tv_sec) * 1.0E6);
+        setitimer(ITIMER_REAL, &timer, NULL);
+    }
+}
+
+// Arm the timeout again from its callback
+HIDDEN void rearm_timer(uint64_t timeout_ticks)
+{
+    if(cntd->enable_watchdog)
+        watchdog_rearm = timeout_ticks;
+    else
+        start_timer_ticks(timeout_ticks);
+}
+
 HIDDEN void start_timer()
 {
-    struct itimerval timer = {0};
-    timer.it_value.tv_usec = (unsigned long) (cntd->eam_timeout * 1.0E6);
-    setitimer(ITIMER_REAL, &timer, NULL);
+    start_timer_ticks(cntd->eam_timeout_ticks);
 }
 
 HIDDEN void reset_timer()
 {
-    struct itimerval timer = {0};
-    setitimer(ITIMER_REAL, &timer, NULL);
+    if(cntd->enable_watchdog)
+        reset_watchdog();
+    else
+    {
+        struct itimerval timer = {0};
+        setitimer(ITIMER_REAL, &timer, NULL);
+    }
 }
 
 HIDDEN void init_timer(void (*callback)())
 {
-    struct sigaction sa = {0};
-    sa.sa_handler = callback;
-    sigaction(SIGALRM, &sa, NULL);
+    if(cntd->enable_watchdog)
+        init_watchdog(callback);
+    else
+    {
+        struct sigaction sa = {0};
+        sa.sa_handler = callback;
+        sigaction(SIGALRM, &sa, NULL);
+    }
 }
 
 HIDDEN void finalize_timer()
 {
-    reset_timer();
+    if(cntd->enable_watchdog)
+        finalize_watchdog();
+    else
+        reset_timer();
 }
 
 HIDDEN int make_timer(timer_t *timerID, void (*func)(int, siginfo_t*, void*), int interval, int expire)
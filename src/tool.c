@@ -81,6 +81,25 @@ HIDDEN int write_int_to_file(char* filename, int value) {
     return 0;
 }
 
+// RAPL power limits in microwatts do not fit an int
+HIDDEN int write_uint64_to_file(char *filename, uint64_t value)
+{
+	char svalue[STRING_SIZE];
+	int len, err;
+	int fd = open(filename, O_RDWR);
+
+	if(fd == -1)
+		return -1;
+
+	len = snprintf(svalue, STRING_SIZE, "%lu", value);
+	err = write(fd, svalue, len);
+	close(fd);
+
+	if(err < 0)
+		return -1;
+	return 0;
+}
+
 HIDDEN double read_time()
 {
     struct timespec sample;
@@ -88,6 +107,52 @@ HIDDEN double read_time()
     return (double) sample.tv_sec + ((double) sample.tv_nsec / 1.0E9);
 }
 
+HIDDEN _Bool tsc_usage = FALSE;
+HIDDEN double tick_freq = 1.0E9;
+
+static int tsc_is_invariant()
+{
+#if defined(__x86_64__)
+    unsigned int eax, ebx, ecx, edx;
+
+    // CPUID.80000007H:EDX[8] reports the invariant TSC
+    if(__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0)
+        return FALSE;
+    return (edx >> 8) & 1;
+#elif defined(__aarch64__) || defined(__powerpc64__)
+    // The generic timer and the timebase run at a constant frequency
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+HIDDEN void init_ticks()
+{
+    uint64_t ticks[2];
+    double time[2];
+    struct timespec delay;
+
+    tsc_usage = cntd->enable_tsc && tsc_is_invariant();
+    if(tsc_usage)
+    {
+        delay.tv_sec = 0;
+        delay.tv_nsec = (long) (TICKS_CALIBRATION_TIME * 1.0E9);
+
+        time[START] = read_time();
+        ticks[START] = read_ticks();
+        nanosleep(&delay, NULL);
+        time[END] = read_time();
+        ticks[END] = read_ticks();
+
+        tick_freq = (double) (ticks[END] - ticks[START]) / (time[END] - time[START]);
+    }
+    else
+        tick_freq = 1.0E9;
+
+    cntd->rank->tick_freq = tick_freq;
+}
+
 HIDDEN uint64_t diff_overflow(uint64_t end, uint64_t start, uint64_t overflow)
 {
     if(end >= start)
@@ -181,7 +246,7 @@ HIDDEN MPI_Datatype get_mpi_datatype_rank()
     MPI_Datatype tmp_type, cpu_type;
     MPI_Aint lb, extent;
 
-    int count = 18;
+    int count = 22;
 
     int array_of_blocklengths[] = {1,                     // world_rank
                                    1,                     // local_rank
@@ -200,7 +265,11 @@ HIDDEN MPI_Datatype get_mpi_datatype_rank()
                                    NUM_MPI_TYPE,          // mpi_type_time
                                    NUM_MPI_TYPE*2,        // mpi_type_data
                                    NUM_MPI_TYPE,          // cntd_mpi_type_cnt
-                                   NUM_MPI_TYPE};         // cntd_mpi_type_time
+                                   NUM_MPI_TYPE,          // cntd_mpi_type_time
+                                   NUM_MPI_CLASS,         // overhead_time
+                                   1,                     // sampling_overhead_time
+                                   NUM_MPI_CLASS,         // sampled_var_time
+                                   NUM_MPI_CLASS};        // sampled_var_data
 
     MPI_Datatype array_of_types[] = {MPI_INT,             // world_rank
                                      MPI_INT,             // local_rank
@@ -219,7 +288,11 @@ HIDDEN MPI_Datatype get_mpi_datatype_rank()
                                      MPI_DOUBLE,          // mpi_type_time
                                      MPI_UINT64_T,        // mpi_type_data
                                      MPI_UINT64_T,        // cntd_mpi_type_cnt
-                                     MPI_DOUBLE};         // cntd_mpi_type_time
+                                     MPI_DOUBLE,          // cntd_mpi_type_time
+                                     MPI_DOUBLE,          // overhead_time
+                                     MPI_DOUBLE,          // sampling_overhead_time
+                                     MPI_DOUBLE,          // sampled_var_time
+                                     MPI_DOUBLE};         // sampled_var_data
 
     MPI_Aint array_of_displacements[] = {offsetof(CNTD_RankInfo_t, world_rank),
                                          offsetof(CNTD_RankInfo_t, local_rank),
@@ -238,11 +311,17 @@ HIDDEN MPI_Datatype get_mpi_datatype_rank()
                                          offsetof(CNTD_RankInfo_t, mpi_type_time),
                                          offsetof(CNTD_RankInfo_t, mpi_type_data),
                                          offsetof(CNTD_RankInfo_t, cntd_mpi_type_cnt),
-                                         offsetof(CNTD_RankInfo_t, cntd_mpi_type_time)};
+                                         offsetof(CNTD_RankInfo_t, cntd_mpi_type_time),
+                                         offsetof(CNTD_RankInfo_t, overhead_time),
+                                         offsetof(CNTD_RankInfo_t, sampling_overhead_time),
+                                         offsetof(CNTD_RankInfo_t, sampled_var_time),
+                                         offsetof(CNTD_RankInfo_t, sampled_var_data)};
 
     PMPI_Type_create_struct(count, array_of_blocklengths, array_of_displacements, array_of_types, &tmp_type);
+    // The fields after sampled_var_data are node-local and not gathered:
+    // the extent of the type must still span the whole structure
     PMPI_Type_get_extent(tmp_type, &lb, &extent);
-    PMPI_Type_create_resized(tmp_type, lb, extent, &cpu_type);
+    PMPI_Type_create_resized(tmp_type, lb, sizeof(CNTD_RankInfo_t), &cpu_type);
     PMPI_Type_commit(&cpu_type);
 
     return cpu_type;
@@ -407,116 +486,237 @@ HIDDEN CNTD_RankInfo_t* get_shmem_cpu(const char shmem_name[], int num_elem)
     return shmem_ptr;
 }
 
-HIDDEN void add_network(MPI_Comm comm, MPI_Type_t type,
-    const int *send_count, MPI_Datatype *send_type, int dest,
-	const int *recv_count, MPI_Datatype *recv_type, int source)
+// Log2 histograms of the message sizes, filled by add_msg_size
+HIDDEN uint64_t mpi_type_msg_size[2][NUM_MPI_TYPE][NUM_MSG_SIZE_BINS];
+
+// Counts are int for the classic bindings and MPI_Count for the MPI-4
+// large-count ones, the bytes are always computed in 64-bit
+static inline uint64_t get_count(const void *count, int i, int large_count)
+{
+	if(large_count)
+		return (uint64_t) ((const MPI_Count *) count)[i];
+	return (uint64_t) ((const int *) count)[i];
+}
+
+// Account num messages of the given size, or only sum their bytes when the
+// accounting is deferred to the starts of a persistent request. The counters
+// are scaled by the weight of the call under sampled accounting.
+static inline void account_data(int dir, MPI_Type_t type, uint64_t size, uint64_t num, uint64_t *deferred)
 {
-	int i, comm_size, send_size, recv_size;
+	uint64_t data = size * num;
+	uint64_t weight = cntd_thread.weight;
+
+	if(deferred != NULL)
+	{
+		deferred[dir] += data;
+		return;
+	}
+
+	add_msg_size(dir, type, size, num * weight);
+	touch_call_counters(type);
+	CALL_COUNTER(mpi_net_data[dir][TOT]) += data * weight;
+	cntd_thread.call_data += data;
+	CALL_COUNTER(mpi_type_data[dir][type]) += data * weight;
+}
+
+static void account_network(MPI_Comm comm, MPI_Type_t type,
+    const void *send_count, MPI_Datatype *send_type, int dest,
+	const void *recv_count, MPI_Datatype *recv_type, int source,
+	int large_count, uint64_t *deferred)
+{
+	int i, comm_size;
+	MPI_Count send_size, recv_size;
     uint64_t data;
+	uint64_t ticks;
+
+	// Calls left out by the sampled accounting
+	if(deferred == NULL && cntd_thread.weight == 0)
+		return;
+
+	ticks = read_ticks();
 
 	// Send
     if(dest == MPI_NONE);
     else if(dest == MPI_ALL)
 	{
-        PMPI_Comm_size(comm, &comm_size);
-		PMPI_Type_size(*send_type, &send_size);
-        data = (*send_count) * send_size * comm_size;
-		cntd->rank->mpi_net_data[SEND][TOT] += data;
-        cntd->rank->mpi_type_data[SEND][type] += data;
+        comm_size = get_comm_size(comm);
+		send_size = get_type_size(*send_type);
+		account_data(SEND, type, get_count(send_count, 0, large_count) * send_size, comm_size, deferred);
 	}
 	else if(dest == MPI_ALLV)
 	{
-        PMPI_Comm_size(comm, &comm_size);
-		PMPI_Type_size(*send_type, &send_size);
+        comm_size = get_comm_size(comm);
+		send_size = get_type_size(*send_type);
 		for(i = 0; i < comm_size; i++)
-        {
-            data = send_count[i] * send_size;
-			cntd->rank->mpi_net_data[SEND][TOT] += data;
-            cntd->rank->mpi_type_data[SEND][type] += data;
-        }
+			account_data(SEND, type, get_count(send_count, i, large_count) * send_size, 1, deferred);
 	}
 	else if(dest == MPI_ALLW)
 	{
-        PMPI_Comm_size(comm, &comm_size);
+        comm_size = get_comm_size(comm);
 		for(i = 0; i < comm_size; i++)
 		{
-			PMPI_Type_size(send_type[i], &send_size);
-            data = send_count[i] * send_size;
-			cntd->rank->mpi_net_data[SEND][TOT] += data;
-            cntd->rank->mpi_type_data[SEND][type] += data;
+			send_size = get_type_size(send_type[i]);
+			account_data(SEND, type, get_count(send_count, i, large_count) * send_size, 1, deferred);
 		}
 	}
     else
 	{ 
-        PMPI_Type_size(*send_type, &send_size);
-        data = (*send_count) * send_size;
-		cntd->rank->mpi_net_data[SEND][TOT] += data;
-        cntd->rank->mpi_type_data[SEND][type] += data;
+        send_size = get_type_size(*send_type);
+        data = get_count(send_count, 0, large_count) * send_size;
+		account_data(SEND, type, data, 1, deferred);
+		// Collectives are recorded per communicator at the end of the call
+		if(cntd->enable_matrix && deferred == NULL && mpi_type_class[type] == MPI_CLASS_P2P)
+			add_matrix_p2p(comm, dest, data);
     }
 
 	// Receive
 	if(source == MPI_NONE);
 	else if(source == MPI_ALL)
 	{
-        PMPI_Comm_size(comm, &comm_size);
-		PMPI_Type_size(*recv_type, &recv_size);
-        data = (*recv_count) * recv_size * comm_size;
-		cntd->rank->mpi_net_data[RECV][TOT] += data;
-        cntd->rank->mpi_type_data[RECV][type] += data;
+        comm_size = get_comm_size(comm);
+		recv_size = get_type_size(*recv_type);
+		account_data(RECV, type, get_count(recv_count, 0, large_count) * recv_size, comm_size, deferred);
 	}
 	else if(source == MPI_ALLV)
 	{
-		PMPI_Comm_size(comm, &comm_size);
-		PMPI_Type_size(*recv_type, &recv_size);
+		comm_size = get_comm_size(comm);
+		recv_size = get_type_size(*recv_type);
 		for(i = 0; i < comm_size; i++)
-        {
-            data = recv_count[i] * recv_size;
-			cntd->rank->mpi_net_data[RECV][TOT] += data;
-            cntd->rank->mpi_type_data[RECV][type] += data;
-        }
+			account_data(RECV, type, get_count(recv_count, i, large_count) * recv_size, 1, deferred);
 	}
 	else if(source == MPI_ALLW)
 	{
-		PMPI_Comm_size(comm, &comm_size);
-
+		comm_size = get_comm_size(comm);
 		for(i = 0; i < comm_size; i++)
 		{
-			PMPI_Type_size(recv_type[i], &recv_size);
-            data = recv_count[i] * recv_size;
-			cntd->rank->mpi_net_data[RECV][TOT] += data;
-            cntd->rank->mpi_type_data[RECV][type] += data;
+			recv_size = get_type_size(recv_type[i]);
+			account_data(RECV, type, get_count(recv_count, i, large_count) * recv_size, 1, deferred);
 		}
 	}
     else
 	{
-		PMPI_Type_size(*recv_type, &recv_size);
-        data = (*recv_count) * recv_size;
-		cntd->rank->mpi_net_data[RECV][TOT] += data;
-        cntd->rank->mpi_type_data[RECV][type] += data;
+		recv_size = get_type_size(*recv_type);
+		account_data(RECV, type, get_count(recv_count, 0, large_count) * recv_size, 1, deferred);
 	}
+
+	cntd_thread.overhead_ticks += read_ticks() - ticks;
+}
+
+HIDDEN void add_network(MPI_Comm comm, MPI_Type_t type,
+    const int *send_count, MPI_Datatype *send_type, int dest,
+	const int *recv_count, MPI_Datatype *recv_type, int source)
+{
+	account_network(comm, type, send_count, send_type, dest, recv_count, recv_type, source, FALSE, NULL);
+}
+
+HIDDEN void add_network_c(MPI_Comm comm, MPI_Type_t type,
+    const MPI_Count *send_count, MPI_Datatype *send_type, int dest,
+	const MPI_Count *recv_count, MPI_Datatype *recv_type, int source)
+{
+	account_network(comm, type, send_count, send_type, dest, recv_count, recv_type, source, TRUE, NULL);
+}
+
+// Bytes moved by every start of a persistent request, accounted by add_start
+HIDDEN void add_network_persistent(MPI_Comm comm, MPI_Type_t type,
+    const int *send_count, MPI_Datatype *send_type, int dest,
+	const int *recv_count, MPI_Datatype *recv_type, int source, uint64_t *start_data)
+{
+	start_data[SEND] = start_data[RECV] = 0;
+	account_network(comm, type, send_count, send_type, dest, recv_count, recv_type, source, FALSE, start_data);
+}
+
+HIDDEN void add_network_persistent_c(MPI_Comm comm, MPI_Type_t type,
+    const MPI_Count *send_count, MPI_Datatype *send_type, int dest,
+	const MPI_Count *recv_count, MPI_Datatype *recv_type, int source, uint64_t *start_data)
+{
+	start_data[SEND] = start_data[RECV] = 0;
+	account_network(comm, type, send_count, send_type, dest, recv_count, recv_type, source, TRUE, start_data);
+}
+
+// Fortran MPI_Alltoallw, the datatype handles are converted one at a time
+// instead of copying the arrays of the communicator size
+HIDDEN void add_network_allw_f(MPI_Comm comm, MPI_Type_t type,
+	const MPI_Fint *send_count, const MPI_Fint *send_type,
+	const MPI_Fint *recv_count, const MPI_Fint *recv_type)
+{
+	int i, comm_size;
+	uint64_t ticks;
+
+	if(cntd_thread.weight == 0)
+		return;
+
+	ticks = read_ticks();
+
+	comm_size = get_comm_size(comm);
+	for(i = 0; i < comm_size; i++)
+	{
+		account_data(SEND, type, (uint64_t) send_count[i] * get_type_size(MPI_Type_f2c(send_type[i])), 1, NULL);
+		account_data(RECV, type, (uint64_t) recv_count[i] * get_type_size(MPI_Type_f2c(recv_type[i])), 1, NULL);
+	}
+
+	cntd_thread.overhead_ticks += read_ticks() - ticks;
+}
+
+// Start of a persistent request, peer is the world rank of the destination
+// of a P2P send or negative
+HIDDEN void add_start(MPI_Type_t type, const uint64_t *start_data, int peer)
+{
+	uint64_t ticks;
+
+	if(cntd_thread.weight == 0)
+		return;
+
+	ticks = read_ticks();
+
+	if(start_data[SEND] > 0)
+	{
+		account_data(SEND, type, start_data[SEND], 1, NULL);
+		if(cntd->enable_matrix && peer >= 0)
+			add_matrix_peer(peer, start_data[SEND]);
+	}
+	if(start_data[RECV] > 0)
+		account_data(RECV, type, start_data[RECV], 1, NULL);
+
+	cntd_thread.overhead_ticks += read_ticks() - ticks;
 }
 
 HIDDEN void add_file(MPI_Type_t type,
-	int read_count, MPI_Datatype read_datatype,
-	int write_count, MPI_Datatype write_datatype)
+	MPI_Count read_count, MPI_Datatype read_datatype,
+	MPI_Count write_count, MPI_Datatype write_datatype)
 {
+	uint64_t ticks;
+	uint64_t weight = cntd_thread.weight;
+
+	if(weight == 0)
+		return;
+
+	ticks = read_ticks();
+
 	if(read_count > 0)
 	{
-        int read_size;
-		PMPI_Type_size(read_datatype, &read_size);
-        uint64_t data = read_count * read_size;
-		cntd->rank->mpi_file_data[READ][TOT] += data;
-        cntd->rank->mpi_type_data[RECV][type] += data;
+        MPI_Count read_size;
+		read_size = get_type_size(read_datatype);
+        uint64_t data = (uint64_t) read_count * read_size;
+		add_msg_size(RECV, type, data, weight);
+		touch_call_counters(type);
+		CALL_COUNTER(mpi_file_data[READ][TOT]) += data * weight;
+		cntd_thread.call_data += data;
+        CALL_COUNTER(mpi_type_data[RECV][type]) += data * weight;
 	}
 
 	if(write_count > 0)
 	{
-        int write_size;
-		PMPI_Type_size(write_datatype, &write_size);
-        uint64_t data = write_count * write_size;
-		cntd->rank->mpi_file_data[WRITE][TOT] += data;
-        cntd->rank->mpi_type_data[SEND][type] += data;
+        MPI_Count write_size;
+		write_size = get_type_size(write_datatype);
+        uint64_t data = (uint64_t) write_count * write_size;
+		add_msg_size(SEND, type, data, weight);
+		touch_call_counters(type);
+		CALL_COUNTER(mpi_file_data[WRITE][TOT]) += data * weight;
+		cntd_thread.call_data += data;
+        CALL_COUNTER(mpi_type_data[SEND][type]) += data * weight;
 	}
+
+	cntd_thread.overhead_ticks += read_ticks() - ticks;
 }
 
 HIDDEN void get_rand_postfix(char *postfix, int size)
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c), CINECA, UNIBO, and ETH Zurich
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *			* Redistributions of source code must retain the above copyright notice, this
+ *				list of conditions and the following disclaimer.
+ *
+ *			* Redistributions in binary form must reproduce the above copyright notice,
+ *				this list of conditions and the following disclaimer in the documentation
+ *				and/or other materials provided with the distribution.
+ *
+ *			* Neither the name of the copyright holder nor the names of its
+ *				contributors may be used to endorse or promote products derived from
+ *				this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cntd.h"
+
+// Uncore frequency scaling. The ranks of a socket count themselves in the
+// segment of the local master when their p-state is lowered: the last one
+// entering lowers the uncore of the socket, the first one leaving restores
+// it. The uncore limit is package-wide, so every rank writes it through its
+// own CPU.
+static int uncore_socket_ranks;
+static int uncore_waiting = FALSE;
+#ifdef INTEL
+#ifdef CPUFREQ
+static int uncore_max_khz;
+static char uncore_max_file[STRING_SIZE];
+#else
+static uint64_t uncore_ratio_limit;
+#endif
+#endif
+
+// Spinlock of the socket, the owner is the world rank plus one. A timer
+// signal interrupting the rank while it holds the lock gives up.
+static int lock_socket(int give_up)
+{
+	int expected;
+	int owner = cntd->rank->world_rank + 1;
+	int *lock = &cntd->local_ranks[0]->uncore_lock[cntd->rank->socket_id];
+
+	for(;;)
+	{
+		expected = 0;
+		if(__atomic_compare_exchange_n(lock, &expected, owner, FALSE, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+			return TRUE;
+		if(give_up && expected == owner)
+			return FALSE;
+		cpu_relax();
+	}
+}
+
+static void unlock_socket()
+{
+	__atomic_store_n(&cntd->local_ranks[0]->uncore_lock[cntd->rank->socket_id], 0, __ATOMIC_RELEASE);
+}
+
+static void set_uncore(int lower)
+{
+	if(!cntd->enable_eam_freq)
+		return;
+
+#ifdef INTEL
+#ifdef CPUFREQ
+	int khz = lower ? cntd->uncore_pstate * 100000 : uncore_max_khz;
+
+	if(write_int_to_file(uncore_max_file, khz) < 0)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to write file: %s\n",
+			cntd->node.hostname, cntd->rank->world_rank, uncore_max_file);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+#else
+	// Bits 6:0 are the maximum ratio, bits 14:8 the minimum one
+	uint64_t value = uncore_ratio_limit;
+
+	if(lower)
+	{
+		uint64_t ratio = cntd->uncore_pstate & 0x7F;
+
+		value = (value & ~0x7FULL) | ratio;
+		if(((value >> 8) & 0x7F) > ratio)
+			value = (value & ~0x7F00ULL) | (ratio << 8);
+	}
+	write_msr(MSR_UNCORE_RATIO_LIMIT, value);
+#endif
+#endif
+}
+
+HIDDEN void uncore_enter_wait()
+{
+	int *waiting = &cntd->local_ranks[0]->uncore_waiting[cntd->rank->socket_id];
+
+	if(!lock_socket(TRUE))
+		return;
+	if(!uncore_waiting)
+	{
+		uncore_waiting = TRUE;
+		if(++(*waiting) == uncore_socket_ranks)
+			set_uncore(TRUE);
+	}
+	unlock_socket();
+}
+
+HIDDEN void uncore_leave_wait()
+{
+	int *waiting = &cntd->local_ranks[0]->uncore_waiting[cntd->rank->socket_id];
+
+	lock_socket(FALSE);
+	if(uncore_waiting)
+	{
+		uncore_waiting = FALSE;
+		if((*waiting)-- == uncore_socket_ranks)
+			set_uncore(FALSE);
+	}
+	unlock_socket();
+}
+
+HIDDEN void init_uncore()
+{
+	int i;
+
+#ifndef INTEL
+	fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Uncore frequency scaling is only supported on Intel processors\n",
+		cntd->node.hostname, cntd->rank->world_rank);
+	PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+#endif
+
+	if(cntd->rank->socket_id < 0 || cntd->rank->socket_id >= MAX_NUM_SOCKETS)
+	{
+		fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Socket %d exceeds the maximum of %d sockets\n",
+			cntd->node.hostname, cntd->rank->world_rank, cntd->rank->socket_id, MAX_NUM_SOCKETS);
+		PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+
+#ifdef INTEL
+	// Limit of the uncore set by the system, restored when leaving MPI
+	if(cntd->enable_eam_freq)
+	{
+#ifdef CPUFREQ
+		char filevalue[STRING_SIZE];
+
+		snprintf(uncore_max_file, STRING_SIZE, UNCORE_MAX_FREQ_KHZ, cntd->rank->socket_id);
+		if(read_str_from_file(uncore_max_file, filevalue) < 0)
+		{
+			fprintf(stderr, "Error: <COUNTDOWN-node:%s-rank:%d> Failed to read file: %s\n",
+				cntd->node.hostname, cntd->rank->world_rank, uncore_max_file);
+			PMPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+		}
+		uncore_max_khz = (int) strtol(filevalue, NULL, 10);
+#else
+		uncore_ratio_limit = read_msr(MSR_UNCORE_RATIO_LIMIT);
+#endif
+	}
+#endif
+
+	// Ranks of the socket, the socket ids are published in the shared memory
+	PMPI_Barrier(cntd->comm_local);
+	uncore_socket_ranks = 0;
+	for(i = 0; i < cntd->local_rank_size; i++)
+		if(cntd->local_ranks[i]->socket_id == cntd->rank->socket_id)
+			uncore_socket_ranks++;
+}
+
+HIDDEN void finalize_uncore()
+{
+	uncore_leave_wait();
+}
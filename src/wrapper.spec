@@ -0,0 +1,2971 @@
+#
+# Copyright (c), CINECA, UNIBO, and ETH Zurich
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#			* Redistributions of source code must retain the above copyright notice, this
+#				list of conditions and the following disclaimer.
+#
+#			* Redistributions in binary form must reproduce the above copyright notice,
+#				this list of conditions and the following disclaimer in the documentation
+#				and/or other materials provided with the distribution.
+#
+#			* Neither the name of the copyright holder nor the names of its
+#				contributors may be used to endorse or promote products derived from
+#				this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Specification of the MPI functions intercepted by COUNTDOWN. wrapper_gen.py
+# generates from this file both the C/C++ and the Fortran PMPI wrappers.
+#
+# section <name>
+#	Preprocessor guard of the following functions: core (always built),
+#	profiling, p2p and accessory (CNTD_DISABLE_*_MPI), persistent
+#	(HAVE_MPI4_PERSISTENT) and mpi4 (MPI_VERSION >= 4, C only).
+#
+# <kind> MPI_Name(<C arguments>)
+#	The kind is the MPI class of the function (collective, p2p, wait, rma, io,
+#	accessory, polling), which selects the inlined prologue and epilogue of
+#	the wrapper, or one of init, finalize and query (MPI_Initialized and
+#	MPI_Finalized, never instrumented). The MPI type is __MPI_NAME, without
+#	the _c suffix of the large-count bindings.
+#
+# Properties of a function, indented by one tab:
+#	comm <expr>			Communicator of the call (default: MPI_COMM_WORLD)
+#	eam					Run the energy-aware policy on a blocking accessory call
+#	debug <fmt> <args>	Extra format and arguments of the DEBUG_MPI prints
+#	before / after		C code before / after the PMPI call
+#	fortran <arguments>	Fortran binding of the function, with the hidden lengths
+#						of the character arguments last and declared size_t
+#	fbefore / fafter	Fortran code before / after the PMPI call
+#
+# Code blocks are indented by one more tab than the properties. Lines starting
+# with // are copied in the C wrappers before the next function.
+
+section core
+
+init MPI_Init(int *argc, char ***argv)
+	fortran MPI_Fint *argc, char *argv, MPI_Fint *ierr, size_t argv_len
+
+init MPI_Init_thread(int *argc, char ***argv, int required, int *provided)
+	fortran MPI_Fint *argc, char *argv, MPI_Fint *required, MPI_Fint *provided, MPI_Fint *ierr, size_t argv_len
+
+finalize MPI_Finalize(void)
+	fortran MPI_Fint *ierr
+
+section profiling
+
+collective MPI_Allgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	before
+		add_network(comm, __MPI_ALLGATHER, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+		MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_ALLGATHER, sendcount, &sendtype_f2c, MPI_ALL, recvcount, &recvtype_f2c, MPI_ALL);
+
+collective MPI_Allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	before
+		add_network(comm, __MPI_ALLGATHERV, &sendcount, &sendtype, MPI_ALL, recvcounts, &recvtype, MPI_ALLV);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *displs, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+		MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_ALLGATHERV, sendcount, &sendtype_f2c, MPI_ALL, recvcounts, &recvtype_f2c, MPI_ALLV);
+
+collective MPI_Allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+	before
+		add_network(comm, __MPI_ALLREDUCE, &count, &datatype, MPI_ALL, &count, &datatype, MPI_ALL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_ALLREDUCE, count, &datatype_f2c, MPI_ALL, count, &datatype_f2c, MPI_ALL);
+
+collective MPI_Alltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	before
+		add_network(comm, __MPI_ALLTOALL, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+		MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_ALLTOALL, sendcount, &sendtype_f2c, MPI_ALL, recvcount, &recvtype_f2c, MPI_ALL);
+
+collective MPI_Alltoallv(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	before
+		add_network(comm, __MPI_ALLTOALLV, sendcounts, &sendtype, MPI_ALLV, recvcounts, &recvtype, MPI_ALLV);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *sdispls, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *rdispls, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+		MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_ALLTOALLV, sendcounts, &sendtype_f2c, MPI_ALLV, recvcounts, &recvtype_f2c, MPI_ALLV);
+
+collective MPI_Alltoallw(const void *sendbuf, const int sendcounts[], const int sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const int rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm)
+	comm comm
+	before
+		add_network(comm, __MPI_ALLTOALLW, sendcounts, (MPI_Datatype*) sendtypes, MPI_ALLW, recvcounts, (MPI_Datatype*) recvtypes, MPI_ALLW);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *sdispls, MPI_Fint *sendtypes, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *rdispls, MPI_Fint *recvtypes, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		add_network_allw_f(MPI_Comm_f2c(*comm), __MPI_ALLTOALLW, sendcounts, sendtypes, recvcounts, recvtypes);
+
+collective MPI_Barrier(MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *ierr
+
+collective MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_BCAST, &count, &datatype, MPI_ALL, NULL, &datatype, MPI_NONE);
+		else
+			add_network(comm, __MPI_BCAST, NULL, NULL, MPI_NONE, &count, &datatype, root);
+	fortran MPI_Fint *buffer, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		if(my_rank == *root)
+			add_network(MPI_Comm_f2c(*comm), __MPI_BCAST, count, &datatype_f2c, MPI_ALL, NULL, NULL, MPI_NONE);
+		else
+			add_network(MPI_Comm_f2c(*comm), __MPI_BCAST, NULL, NULL, MPI_NONE, count, &datatype_f2c, *root);
+
+collective MPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm *newcomm)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *color, MPI_Fint *key, MPI_Fint *newcomm, MPI_Fint *ierr
+
+collective MPI_Comm_split_type(MPI_Comm comm, int split_type, int key, MPI_Info info, MPI_Comm *newcomm)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *split_type, MPI_Fint *key, MPI_Fint *info, MPI_Fint *newcomm, MPI_Fint *ierr
+
+collective MPI_Exscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *ierr
+
+io MPI_File_sync(MPI_File fh)
+	fortran MPI_Fint *fh, MPI_Fint *ierr
+
+collective MPI_Gather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_GATHER, NULL, NULL, MPI_NONE, &recvcount, &recvtype, MPI_ALL);
+		else
+			add_network(comm, __MPI_GATHER, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		if(my_rank == *root)
+		{
+			MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_GATHER, NULL, NULL, MPI_NONE, recvcount, &recvtype_f2c, MPI_ALL);
+		}
+		else
+		{
+			MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_GATHER, sendcount, &sendtype_f2c, *root, NULL, NULL, MPI_NONE);
+		}
+
+collective MPI_Gatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_GATHERV, NULL, NULL, MPI_NONE, recvcounts, &recvtype, MPI_ALLV);
+		else
+			add_network(comm, __MPI_GATHERV, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *displs, MPI_Fint *recvtype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		if(my_rank == *root)
+		{
+			MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_GATHERV, NULL, NULL, MPI_NONE, recvcounts, &recvtype_f2c, MPI_ALLV);
+		}
+		else
+		{
+			MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_GATHERV, sendcount, &sendtype_f2c, *root, NULL, NULL, MPI_NONE);
+		}
+
+collective MPI_Neighbor_allgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *ierr
+
+collective MPI_Neighbor_allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *displs, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *ierr
+
+collective MPI_Neighbor_alltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *ierr
+
+collective MPI_Neighbor_alltoallv(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *sdispls, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *rdispls, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *ierr
+
+collective MPI_Neighbor_alltoallw(const void *sendbuf, const int sendcounts[], const MPI_Aint sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const MPI_Aint rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *sdispls, MPI_Fint *sendtypes, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *rdispls, MPI_Fint *recvtypes, MPI_Fint *comm, MPI_Fint *ierr
+
+collective MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_REDUCE, NULL, NULL, MPI_NONE, &count, &datatype, MPI_ALL);
+		else
+			add_network(comm, __MPI_REDUCE, &count, &datatype, root, NULL, NULL, MPI_NONE);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		if(my_rank == *root)
+			add_network(MPI_Comm_f2c(*comm), __MPI_REDUCE, NULL, NULL, MPI_NONE, count, &datatype_f2c, MPI_ALL);
+		else
+			add_network(MPI_Comm_f2c(*comm), __MPI_REDUCE, count, &datatype_f2c, *root, NULL, NULL, MPI_NONE);
+
+collective MPI_Reduce_scatter(const void *sendbuf, void *recvbuf, const int recvcounts[], MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network(comm, __MPI_REDUCE_SCATTER, recvcounts, &datatype, MPI_ALLV, recvcounts, &datatype, MPI_ALLV);
+		else
+			add_network(comm, __MPI_REDUCE_SCATTER, &recvcounts[my_rank], &datatype, 0, &recvcounts[my_rank], &datatype, 0);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		if(my_rank == 0)
+			add_network(MPI_Comm_f2c(*comm), __MPI_REDUCE_SCATTER, recvcounts, &datatype_f2c, MPI_ALLV, recvcounts, &datatype_f2c, MPI_ALLV);
+		else
+			add_network(MPI_Comm_f2c(*comm), __MPI_REDUCE_SCATTER, &recvcounts[my_rank], &datatype_f2c, 0, &recvcounts[my_rank], &datatype_f2c, 0);
+
+collective MPI_Scan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *ierr
+
+collective MPI_Scatter(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_SCATTER, &sendcount, &sendtype, MPI_ALL, NULL, NULL, MPI_NONE);
+		else
+			add_network(comm, __MPI_SCATTER, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		if(my_rank == *root)
+		{
+			MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_SCATTER, sendcount, &sendtype_f2c, MPI_ALL, NULL, NULL, MPI_NONE);
+		}
+		else
+		{
+			MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_SCATTER, NULL, NULL, MPI_NONE, recvcount, &recvtype_f2c, *root);
+		}
+
+collective MPI_Scatterv(const void *sendbuf, const int sendcounts[], const int displs[], MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_SCATTERV, sendcounts, &sendtype, MPI_ALLV, NULL, NULL, MPI_NONE);
+		else
+			add_network(comm, __MPI_SCATTERV, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *displs, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		if(my_rank == *root)
+		{
+			MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_SCATTERV, sendcounts, &sendtype_f2c, MPI_ALLV, NULL, NULL, MPI_NONE);
+		}
+		else
+		{
+			MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_SCATTERV, NULL, NULL, MPI_NONE, recvcount, &recvtype_f2c, *root);
+		}
+
+wait MPI_Waitall(int count, MPI_Request array_of_requests[], MPI_Status *array_of_statuses)
+	before
+		MPI_Request *saved_requests = save_requests(count, array_of_requests);
+	after
+		complete_requests(count, saved_requests, NULL, 0);
+	fortran MPI_Fint *count, MPI_Fint *array_of_requests, MPI_Fint *array_of_statuses, MPI_Fint *ierr
+	fbefore
+		MPI_Request *saved_requests = save_requests_f(*count, array_of_requests);
+	fafter
+		complete_requests(*count, saved_requests, NULL, 0);
+
+wait MPI_Waitany(int count, MPI_Request array_of_requests[], int *index, MPI_Status *status)
+	before
+		MPI_Request *saved_requests = save_requests(count, array_of_requests);
+	after
+		complete_requests(1, saved_requests, index, 0);
+	fortran MPI_Fint *count, MPI_Fint *array_of_requests, MPI_Fint *index, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Request *saved_requests = save_requests_f(*count, array_of_requests);
+	fafter
+		complete_requests(1, saved_requests, index, 1);
+
+wait MPI_Wait(MPI_Request *request, MPI_Status *status)
+	before
+		MPI_Request *saved_requests = save_requests(1, request);
+	after
+		complete_requests(1, saved_requests, NULL, 0);
+	fortran MPI_Fint *request, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Request *saved_requests = save_requests_f(1, request);
+	fafter
+		complete_requests(1, saved_requests, NULL, 0);
+
+wait MPI_Waitsome(int incount, MPI_Request array_of_requests[], int *outcount, int array_of_indices[], MPI_Status array_of_statuses[])
+	before
+		MPI_Request *saved_requests = save_requests(incount, array_of_requests);
+	after
+		complete_requests(*outcount, saved_requests, array_of_indices, 0);
+	fortran MPI_Fint *incount, MPI_Fint *array_of_requests, MPI_Fint *outcount, MPI_Fint *array_of_indices, MPI_Fint *array_of_statuses, MPI_Fint *ierr
+	fbefore
+		MPI_Request *saved_requests = save_requests_f(*incount, array_of_requests);
+	fafter
+		complete_requests(*outcount, saved_requests, array_of_indices, 1);
+
+rma MPI_Win_flush(int rank, MPI_Win win)
+	fortran MPI_Fint *rank, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_flush_all(MPI_Win win)
+	fortran MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_flush_local(int rank, MPI_Win win)
+	fortran MPI_Fint *rank, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_flush_local_all(MPI_Win win)
+	fortran MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_lock(int lock_type, int rank, int assert, MPI_Win win)
+	fortran MPI_Fint *lock_type, MPI_Fint *rank, MPI_Fint *assert, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_lock_all(int assert, MPI_Win win)
+	fortran MPI_Fint *assert, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_sync(MPI_Win win)
+	fortran MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_wait(MPI_Win win)
+	fortran MPI_Fint *win, MPI_Fint *ierr
+
+section p2p
+
+p2p MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network(comm, __MPI_SEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_SEND, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE);
+
+p2p MPI_Sendrecv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, int dest, int sendtag, void *recvbuf, int recvcount, MPI_Datatype recvtype, int source, int recvtag, MPI_Comm comm, MPI_Status *status)
+	comm comm
+	debug FROM_RANK:%d-TO_RANK:%d source, dest
+	before
+		add_network(comm, __MPI_SENDRECV, &sendcount, &sendtype, dest, &recvcount, &recvtype, source);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *dest, MPI_Fint *sendtag, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *source, MPI_Fint *recvtag, MPI_Fint *comm, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+		MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_SENDRECV, sendcount, &sendtype_f2c, *dest, recvcount, &recvtype_f2c, *source);
+
+p2p MPI_Sendrecv_replace(void * buf, int count, MPI_Datatype datatype, int dest, int sendtag, int source, int recvtag, MPI_Comm comm, MPI_Status *status)
+	comm comm
+	debug FROM_RANK:%d-TO_RANK:%d source, dest
+	before
+		add_network(comm, __MPI_SENDRECV_REPLACE, &count, &datatype, dest, &count, &datatype, source);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *sendtag, MPI_Fint *source, MPI_Fint *recvtag, MPI_Fint *comm, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_SENDRECV_REPLACE, count, &datatype_f2c, *dest, count, &datatype_f2c, *source);
+
+p2p MPI_Ssend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network(comm, __MPI_SSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_SSEND, (int*) count, &datatype_f2c, *dest, NULL, &datatype_f2c, MPI_NONE);
+
+p2p MPI_Bsend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network(comm, __MPI_BSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_BSEND, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE);
+
+p2p MPI_Rsend(const void *ibuf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network(comm, __MPI_RSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	fortran MPI_Fint *ibuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_RSEND, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE);
+
+p2p MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status)
+	comm comm
+	debug RANK:%d source
+	before
+		add_network(comm, __MPI_RECV, NULL, NULL, MPI_NONE, &count, &datatype, source);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *source, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_RECV, NULL, NULL, MPI_NONE, count, &datatype_f2c, *source);
+
+wait MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status)
+	comm comm
+	debug RANK:%d source
+	fortran MPI_Fint *source, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *status, MPI_Fint *ierr
+
+p2p MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network(comm, __MPI_ISEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_ISEND, *request, dest, NULL);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_ISEND, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE);
+	fafter
+		add_request_f(__MPI_ISEND, *request, *dest, NULL);
+
+p2p MPI_Issend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network(comm, __MPI_ISSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_ISSEND, *request, dest, NULL);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_ISSEND, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE);
+	fafter
+		add_request_f(__MPI_ISSEND, *request, *dest, NULL);
+
+p2p MPI_Irsend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network(comm, __MPI_IRSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IRSEND, *request, dest, NULL);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_IRSEND, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE);
+	fafter
+		add_request_f(__MPI_IRSEND, *request, *dest, NULL);
+
+p2p MPI_Ibsend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network(comm, __MPI_IBSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IBSEND, *request, dest, NULL);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_IBSEND, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE);
+	fafter
+		add_request_f(__MPI_IBSEND, *request, *dest, NULL);
+
+p2p MPI_Irecv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d source
+	before
+		add_network(comm, __MPI_IRECV, NULL, NULL, MPI_NONE, &count, &datatype, source);
+	after
+		add_request(__MPI_IRECV, *request, source, NULL);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *source, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_IRECV, NULL, NULL, MPI_NONE, count, &datatype_f2c, *source);
+	fafter
+		add_request_f(__MPI_IRECV, *request, *source, NULL);
+
+polling MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *status)
+	comm comm
+	debug RANK:%d source
+	after
+		set_poll_result(*flag);
+	fortran MPI_Fint *source, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *flag, MPI_Fint *status, MPI_Fint *ierr
+	fafter
+		set_poll_result(*flag);
+
+section accessory
+
+rma MPI_Accumulate(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win)
+	fortran MPI_Fint *origin_addr, MPI_Fint *origin_count, MPI_Fint *origin_datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *target_count, MPI_Fint *target_datatype, MPI_Fint *op, MPI_Fint *win, MPI_Fint *ierr
+
+accessory MPI_Add_error_class(int *errorclass)
+	fortran MPI_Fint *errorclass, MPI_Fint *ierr
+
+accessory MPI_Add_error_code(int errorclass, int *errorcode)
+	fortran MPI_Fint *errorclass, MPI_Fint *errorcode, MPI_Fint *ierr
+
+accessory MPI_Add_error_string(int errorcode, const char *string)
+	fortran MPI_Fint *errorcode, char *string, MPI_Fint *ierr, size_t string_len
+
+collective MPI_Iallgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network(comm, __MPI_IALLGATHER, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL);
+	after
+		add_request(__MPI_IALLGATHER, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+		MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_IALLGATHER, sendcount, &sendtype_f2c, MPI_ALL, recvcount, &recvtype_f2c, MPI_ALL);
+	fafter
+		add_request_f(__MPI_IALLGATHER, *request, MPI_ALL, NULL);
+
+collective MPI_Iallgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network(comm, __MPI_IALLGATHERV, &sendcount, &sendtype, MPI_ALL, recvcounts, &recvtype, MPI_ALLV);
+	after
+		add_request(__MPI_IALLGATHERV, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *displs, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+		MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_IALLGATHERV, sendcount, &sendtype_f2c, MPI_ALL, recvcounts, &recvtype_f2c, MPI_ALLV);
+	fafter
+		add_request_f(__MPI_IALLGATHERV, *request, MPI_ALL, NULL);
+
+accessory MPI_Alloc_mem(MPI_Aint size, MPI_Info info, void *baseptr)
+	fortran MPI_Fint *size, MPI_Fint *info, MPI_Fint *baseptr, MPI_Fint *ierr
+
+collective MPI_Iallreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network(comm, __MPI_IALLREDUCE, &count, &datatype, MPI_ALL, &count, &datatype, MPI_ALL);
+	after
+		add_request(__MPI_IALLREDUCE, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_IALLREDUCE, count, &datatype_f2c, MPI_ALL, count, &datatype_f2c, MPI_ALL);
+	fafter
+		add_request_f(__MPI_IALLREDUCE, *request, MPI_ALL, NULL);
+
+collective MPI_Ialltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network(comm, __MPI_IALLTOALL, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL);
+	after
+		add_request(__MPI_IALLTOALL, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+		MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_IALLTOALL, sendcount, &sendtype_f2c, MPI_ALL, recvcount, &recvtype_f2c, MPI_ALL);
+	fafter
+		add_request_f(__MPI_IALLTOALL, *request, MPI_ALL, NULL);
+
+collective MPI_Ialltoallv(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network(comm, __MPI_IALLTOALLV, sendcounts, &sendtype, MPI_ALLV, recvcounts, &recvtype, MPI_ALLV);
+	after
+		add_request(__MPI_IALLTOALLV, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *sdispls, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *rdispls, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+		MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+		add_network(MPI_Comm_f2c(*comm), __MPI_IALLTOALLV, sendcounts, &sendtype_f2c, MPI_ALLV, recvcounts, &recvtype_f2c, MPI_ALLV);
+	fafter
+		add_request_f(__MPI_IALLTOALLV, *request, MPI_ALL, NULL);
+
+collective MPI_Ialltoallw(const void *sendbuf, const int sendcounts[], const int sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const int rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network(comm, __MPI_IALLTOALLW, sendcounts, (MPI_Datatype*) sendtypes, MPI_ALLW, recvcounts, (MPI_Datatype*) recvtypes, MPI_ALLW);
+	after
+		add_request(__MPI_IALLTOALLW, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *sdispls, MPI_Fint *sendtypes, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *rdispls, MPI_Fint *recvtypes, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		add_network_allw_f(MPI_Comm_f2c(*comm), __MPI_IALLTOALLW, sendcounts, sendtypes, recvcounts, recvtypes);
+	fafter
+		add_request_f(__MPI_IALLTOALLW, *request, MPI_ALL, NULL);
+
+collective MPI_Ibarrier(MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_IBARRIER, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_IBARRIER, *request, MPI_ALL, NULL);
+
+collective MPI_Ibcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_IBCAST, &count, &datatype, MPI_ALL, NULL, NULL, MPI_NONE);
+		else
+			add_network(comm, __MPI_IBCAST, NULL, NULL, MPI_NONE, &count, &datatype, root);
+	after
+		add_request(__MPI_IBCAST, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *buffer, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		if(my_rank == *root)
+			add_network(MPI_Comm_f2c(*comm), __MPI_IBCAST, count, &datatype_f2c, MPI_ALL, NULL, NULL, MPI_NONE);
+		else
+			add_network(MPI_Comm_f2c(*comm), __MPI_IBCAST, NULL, NULL, MPI_NONE, count, &datatype_f2c, *root);
+	fafter
+		add_request_f(__MPI_IBCAST, *request, MPI_ALL, NULL);
+
+p2p MPI_Bsend_init(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent(comm, __MPI_BSEND_INIT, &count, &datatype, dest, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request_p2p_init(__MPI_BSEND_INIT, comm, *request, dest, start_data);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		uint64_t start_data[2];
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network_persistent(MPI_Comm_f2c(*comm), __MPI_BSEND_INIT, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE, start_data);
+	fafter
+		add_request_p2p_init_f(__MPI_BSEND_INIT, *comm, *request, *dest, start_data);
+
+accessory MPI_Buffer_attach(void *buffer, int size)
+	fortran MPI_Fint *buffer, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_Buffer_detach(void *buffer, int *size)
+	fortran MPI_Fint *buffer, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_Cancel(MPI_Request *request)
+	before
+		cancel_request(*request);
+	fortran MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		cancel_request_f(*request);
+
+accessory MPI_Cart_coords(MPI_Comm comm, int rank, int maxdims, int coords[])
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *rank, MPI_Fint *maxdims, MPI_Fint *coords, MPI_Fint *ierr
+
+collective MPI_Cart_create(MPI_Comm old_comm, int ndims, const int dims[], const int periods[], int reorder, MPI_Comm *comm_cart)
+	comm old_comm
+	fortran MPI_Fint *old_comm, MPI_Fint *ndims, MPI_Fint *dims, MPI_Fint *periods, MPI_Fint *reorder, MPI_Fint *comm_cart, MPI_Fint *ierr
+
+accessory MPI_Cart_get(MPI_Comm comm, int maxdims, int dims[], int periods[], int coords[])
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *maxdims, MPI_Fint *dims, MPI_Fint *periods, MPI_Fint *coords, MPI_Fint *ierr
+
+accessory MPI_Cart_map(MPI_Comm comm, int ndims, const int dims[], const int periods[], int *newrank)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *ndims, MPI_Fint *dims, MPI_Fint *periods, MPI_Fint *newrank, MPI_Fint *ierr
+
+accessory MPI_Cart_rank(MPI_Comm comm, const int coords[], int *rank)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *coords, MPI_Fint *rank, MPI_Fint *ierr
+
+accessory MPI_Cart_shift(MPI_Comm comm, int direction, int disp, int *rank_source, int *rank_dest)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *direction, MPI_Fint *disp, MPI_Fint *rank_source, MPI_Fint *rank_dest, MPI_Fint *ierr
+
+collective MPI_Cart_sub(MPI_Comm comm, const int remain_dims[], MPI_Comm *new_comm)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *remain_dims, MPI_Fint *new_comm, MPI_Fint *ierr
+
+accessory MPI_Cartdim_get(MPI_Comm comm, int *ndims)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *ndims, MPI_Fint *ierr
+
+accessory MPI_Close_port(const char *port_name)
+	fortran char *port_name, MPI_Fint *ierr, size_t port_name_len
+
+accessory MPI_Comm_accept(const char *port_name, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *newcomm)
+	comm comm
+	eam
+	fortran char *port_name, MPI_Fint *info, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *newcomm, MPI_Fint *ierr, size_t port_name_len
+
+accessory MPI_Comm_call_errhandler(MPI_Comm comm, int errorcode)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *errorcode, MPI_Fint *ierr
+
+accessory MPI_Comm_compare(MPI_Comm comm1, MPI_Comm comm2, int *result)
+	fortran MPI_Fint *comm1, MPI_Fint *comm2, MPI_Fint *result, MPI_Fint *ierr
+
+accessory MPI_Comm_connect(const char *port_name, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *newcomm)
+	eam
+	fortran char *port_name, MPI_Fint *info, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *newcomm, MPI_Fint *ierr, size_t port_name_len
+
+accessory MPI_Comm_create_errhandler(MPI_Comm_errhandler_function *function, MPI_Errhandler *errhandler)
+	fortran MPI_Fint *function, MPI_Fint *errhandler, MPI_Fint *ierr
+
+accessory MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn, MPI_Comm_delete_attr_function *comm_delete_attr_fn, int *comm_keyval, void *extra_state)
+	fortran MPI_Fint *comm_copy_attr_fn, MPI_Fint *comm_delete_attr_fn, MPI_Fint *comm_keyval, MPI_Fint *extra_state, MPI_Fint *ierr
+
+collective MPI_Comm_create_group(MPI_Comm comm, MPI_Group group, int tag, MPI_Comm *newcomm)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *group, MPI_Fint *tag, MPI_Fint *newcomm, MPI_Fint *ierr
+
+collective MPI_Comm_create(MPI_Comm comm, MPI_Group group, MPI_Comm *newcomm)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *group, MPI_Fint *newcomm, MPI_Fint *ierr
+
+accessory MPI_Comm_delete_attr(MPI_Comm comm, int comm_keyval)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *comm_keyval, MPI_Fint *ierr
+
+accessory MPI_Comm_disconnect(MPI_Comm *comm)
+	comm *comm
+	eam
+	fortran MPI_Fint *comm, MPI_Fint *ierr
+
+collective MPI_Comm_dup(MPI_Comm comm, MPI_Comm *newcomm)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *newcomm, MPI_Fint *ierr
+
+collective MPI_Comm_idup(MPI_Comm comm, MPI_Comm *newcomm, MPI_Request *request)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *newcomm, MPI_Fint *request, MPI_Fint *ierr
+
+collective MPI_Comm_dup_with_info(MPI_Comm comm, MPI_Info info, MPI_Comm *newcomm)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *info, MPI_Fint *newcomm, MPI_Fint *ierr
+
+accessory MPI_Comm_free_keyval(int *comm_keyval)
+	fortran MPI_Fint *comm_keyval, MPI_Fint *ierr
+
+accessory MPI_Comm_free(MPI_Comm *comm)
+	comm *comm
+	fortran MPI_Fint *comm, MPI_Fint *ierr
+
+accessory MPI_Comm_get_attr(MPI_Comm comm, int comm_keyval, void *attribute_val, int *flag)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *comm_keyval, MPI_Fint *attribute_val, MPI_Fint *flag, MPI_Fint *ierr
+
+collective MPI_Dist_graph_create(MPI_Comm comm_old, int n, const int nodes[], const int degrees[], const int targets[], const int weights[], MPI_Info info, int reorder, MPI_Comm *newcomm)
+	comm comm_old
+	fortran MPI_Fint *comm_old, MPI_Fint *n, MPI_Fint *nodes, MPI_Fint *degrees, MPI_Fint *targets, MPI_Fint *weights, MPI_Fint *info, MPI_Fint *reorder, MPI_Fint *newcomm, MPI_Fint *ierr
+
+collective MPI_Dist_graph_create_adjacent(MPI_Comm comm_old, int indegree, const int sources[], const int sourceweights[], int outdegree, const int destinations[], const int destweights[], MPI_Info info, int reorder, MPI_Comm *comm_dist_graph)
+	comm comm_old
+	fortran MPI_Fint *comm_old, MPI_Fint *indegree, MPI_Fint *sources, MPI_Fint *sourceweights, MPI_Fint *outdegree, MPI_Fint *destinations, MPI_Fint *destweights, MPI_Fint *info, MPI_Fint *reorder, MPI_Fint *comm_dist_graph, MPI_Fint *ierr
+
+accessory MPI_Dist_graph_neighbors(MPI_Comm comm, int maxindegree, int sources[], int sourceweights[], int maxoutdegree, int destinations[], int destweights[])
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *maxindegree, MPI_Fint *sources, MPI_Fint *sourceweights, MPI_Fint *maxoutdegree, MPI_Fint *destinations, MPI_Fint *destweights, MPI_Fint *ierr
+
+accessory MPI_Dist_graph_neighbors_count(MPI_Comm comm, int *inneighbors, int *outneighbors, int *weighted)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *inneighbors, MPI_Fint *outneighbors, MPI_Fint *weighted, MPI_Fint *ierr
+
+accessory MPI_Comm_get_errhandler(MPI_Comm comm, MPI_Errhandler *erhandler)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *erhandler, MPI_Fint *ierr
+
+accessory MPI_Comm_get_info(MPI_Comm comm, MPI_Info *info_used)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *info_used, MPI_Fint *ierr
+
+accessory MPI_Comm_get_name(MPI_Comm comm, char *comm_name, int *resultlen)
+	comm comm
+	fortran MPI_Fint *comm, char *comm_name, MPI_Fint *resultlen, MPI_Fint *ierr, size_t name_len
+
+accessory MPI_Comm_get_parent(MPI_Comm *parent)
+	fortran MPI_Fint *parent, MPI_Fint *ierr
+
+accessory MPI_Comm_group(MPI_Comm comm, MPI_Group *group)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *group, MPI_Fint *ierr
+
+accessory MPI_Comm_join(int fd, MPI_Comm *intercomm)
+	eam
+	fortran MPI_Fint *fd, MPI_Fint *intercomm, MPI_Fint *ierr
+
+accessory MPI_Comm_rank(MPI_Comm comm, int *rank)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *rank, MPI_Fint *ierr
+
+accessory MPI_Comm_remote_group(MPI_Comm comm, MPI_Group *group)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *group, MPI_Fint *ierr
+
+accessory MPI_Comm_remote_size(MPI_Comm comm, int *size)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *comm_keyval, MPI_Fint *attribute_val, MPI_Fint *ierr
+
+accessory MPI_Comm_set_errhandler(MPI_Comm comm, MPI_Errhandler errhandler)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *errhandler, MPI_Fint *ierr
+
+accessory MPI_Comm_set_info(MPI_Comm comm, MPI_Info info)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *info, MPI_Fint *ierr
+
+accessory MPI_Comm_set_name(MPI_Comm comm, const char *comm_name)
+	comm comm
+	fortran MPI_Fint *comm, char *comm_name, MPI_Fint *ierr, size_t name_len
+
+accessory MPI_Comm_size(MPI_Comm comm, int *size)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[])
+	comm comm
+	eam
+	fortran char *command, char *argv, MPI_Fint *maxprocs, MPI_Fint *info, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *intercomm, MPI_Fint *array_of_errcodes, MPI_Fint *ierr, size_t cmd_len, size_t string_len
+
+accessory MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[])
+	comm comm
+	eam
+	fortran MPI_Fint *count, char *array_of_commands, char *array_of_argv, MPI_Fint *array_of_maxprocs, MPI_Fint *array_of_info, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *intercomm, MPI_Fint *array_of_errcodes, MPI_Fint *ierr, size_t cmd_string_len, size_t argv_string_len
+
+accessory MPI_Comm_test_inter(MPI_Comm comm, int *flag)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *flag, MPI_Fint *ierr
+
+rma MPI_Compare_and_swap(const void *origin_addr, const void *compare_addr, void *result_addr, MPI_Datatype datatype, int target_rank, MPI_Aint target_disp, MPI_Win win)
+	fortran MPI_Fint *origin_addr, MPI_Fint *compare_addr, MPI_Fint *result_addr, MPI_Fint *datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *win, MPI_Fint *ierr
+
+accessory MPI_Dims_create(int nnodes, int ndims, int dims[])
+	fortran MPI_Fint *nnodes, MPI_Fint *ndims, MPI_Fint *dims, MPI_Fint *ierr
+
+accessory MPI_Errhandler_free(MPI_Errhandler *errhandler)
+	fortran MPI_Fint *errhandler, MPI_Fint *ierr
+
+accessory MPI_Error_class(int errorcode, int *errorclass)
+	fortran MPI_Fint *errorcode, MPI_Fint *errorclass, MPI_Fint *ierr
+
+accessory MPI_Error_string(int errorcode, char *string, int *resultlen)
+	fortran MPI_Fint *errorcode, char *string, MPI_Fint *resultlen, MPI_Fint *ierr, size_t string_len
+
+rma MPI_Fetch_and_op(const void *origin_addr, void *result_addr, MPI_Datatype datatype, int target_rank, MPI_Aint target_disp, MPI_Op op, MPI_Win win)
+	fortran MPI_Fint *origin_addr, MPI_Fint *result_addr, MPI_Fint *datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *op, MPI_Fint *win, MPI_Fint *ierr
+
+collective MPI_Iexscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_IEXSCAN, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_IEXSCAN, *request, MPI_ALL, NULL);
+
+accessory MPI_File_call_errhandler(MPI_File fh, int errorcode)
+	fortran MPI_Fint *fh, MPI_Fint *errorcode, MPI_Fint *ierr
+
+accessory MPI_File_create_errhandler(MPI_File_errhandler_function *function, MPI_Errhandler *errhandler)
+	fortran MPI_Fint *function, MPI_Fint *errhandler, MPI_Fint *ierr
+
+accessory MPI_File_set_errhandler(MPI_File file, MPI_Errhandler errhandler)
+	fortran  MPI_Fint *file, MPI_Fint *errhandler, MPI_Fint *ierr
+
+accessory MPI_File_get_errhandler(MPI_File file, MPI_Errhandler *errhandler)
+	fortran  MPI_Fint *file, MPI_Fint *errhandler, MPI_Fint *ierr
+
+io MPI_File_open(MPI_Comm comm, const char *filename, int amode, MPI_Info info, MPI_File *fh)
+	comm comm
+	fortran MPI_Fint *comm, char *filename, MPI_Fint *amode, MPI_Fint *info, MPI_Fint *fh, MPI_Fint *ierr, size_t name_len
+
+io MPI_File_close(MPI_File *fh)
+	fortran MPI_Fint *fh, MPI_Fint *ierr
+
+io MPI_File_delete(const char *filename, MPI_Info info)
+	fortran char *filename, MPI_Fint *info, MPI_Fint *ierr, size_t filename_len
+
+io MPI_File_set_size(MPI_File fh, MPI_Offset size)
+	fortran MPI_Fint *fh, MPI_Fint *size, MPI_Fint *ierr
+
+io MPI_File_preallocate(MPI_File fh, MPI_Offset size)
+	fortran MPI_Fint *fh, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_File_get_size(MPI_File fh, MPI_Offset *size)
+	fortran MPI_Fint *fh, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_File_get_group(MPI_File fh, MPI_Group *group)
+	fortran MPI_Fint *fh, MPI_Fint *group, MPI_Fint *ierr
+
+accessory MPI_File_get_amode(MPI_File fh, int *amode)
+	fortran MPI_Fint *fh, MPI_Fint *amode, MPI_Fint *ierr
+
+accessory MPI_File_set_info(MPI_File fh, MPI_Info info)
+	fortran MPI_Fint *fh, MPI_Fint *info, MPI_Fint *ierr
+
+accessory MPI_File_get_info(MPI_File fh, MPI_Info *info_used)
+	fortran MPI_Fint *fh, MPI_Fint *info_used, MPI_Fint *ierr
+
+io MPI_File_set_view(MPI_File fh, MPI_Offset disp, MPI_Datatype etype, MPI_Datatype filetype, const char *datarep, MPI_Info info)
+	fortran MPI_Fint *fh, MPI_Fint *disp, MPI_Fint *etype, MPI_Fint *filetype, char *datarep, MPI_Fint *info, MPI_Fint *ierr, size_t datarep_len
+
+accessory MPI_File_get_view(MPI_File fh, MPI_Offset *disp, MPI_Datatype *etype, MPI_Datatype *filetype, char *datarep)
+	fortran MPI_Fint *fh, MPI_Fint *disp, MPI_Fint *etype, MPI_Fint *filetype, char *datarep, MPI_Fint *ierr, size_t datarep_len
+
+io MPI_File_read_at(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_AT, count, datatype, 0, 0);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_READ_AT, *count, datatype_f2c, 0, 0);
+
+io MPI_File_read_at_all(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_AT_ALL, count, datatype, 0, 0);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_READ_AT_ALL, *count, datatype_f2c, 0, 0);
+
+io MPI_File_write_at(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_AT, 0, 0, count, datatype);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_WRITE_AT, 0, 0, *count, datatype_f2c);
+
+io MPI_File_write_at_all(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_AT_ALL, 0, 0, count, datatype);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_WRITE_AT_ALL, 0, 0, *count, datatype_f2c);
+
+io MPI_File_iread_at(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD_AT, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD_AT, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IREAD_AT, *count, datatype_f2c, 0, 0);
+	fafter
+		add_request_f(__MPI_FILE_IREAD_AT, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite_at(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE_AT, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE_AT, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IWRITE_AT, 0, 0, *count, datatype_f2c);
+	fafter
+		add_request_f(__MPI_FILE_IWRITE_AT, *request, MPI_NONE, NULL);
+
+io MPI_File_iread_at_all(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD_AT_ALL, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD_AT_ALL, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IREAD_AT_ALL, *count, datatype_f2c, 0, 0);
+	fafter
+		add_request_f(__MPI_FILE_IREAD_AT_ALL, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite_at_all(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE_AT_ALL, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE_AT_ALL, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IWRITE_AT_ALL, 0, 0, *count, datatype_f2c);
+	fafter
+		add_request_f(__MPI_FILE_IWRITE_AT_ALL, *request, MPI_NONE, NULL);
+
+io MPI_File_read(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ, count, datatype, 0, 0);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_READ, *count, datatype_f2c, 0, 0);
+
+io MPI_File_read_all(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_ALL, count, datatype, 0, 0);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_READ_ALL, *count, datatype_f2c, 0, 0);
+
+io MPI_File_write(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE, 0, 0, count, datatype);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_WRITE, 0, 0, *count, datatype_f2c);
+
+io MPI_File_write_all(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_ALL, 0, 0, count, datatype);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_WRITE_ALL, 0, 0, *count, datatype_f2c);
+
+io MPI_File_iread(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IREAD, *count, datatype_f2c, 0, 0);
+	fafter
+		add_request_f(__MPI_FILE_IREAD, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IWRITE, 0, 0, *count, datatype_f2c);
+	fafter
+		add_request_f(__MPI_FILE_IWRITE, *request, MPI_NONE, NULL);
+
+io MPI_File_iread_all(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD_ALL, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD_ALL, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IREAD_ALL, *count, datatype_f2c, 0, 0);
+	fafter
+		add_request_f(__MPI_FILE_IREAD_ALL, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite_all(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE_ALL, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE_ALL, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IWRITE_ALL, 0, 0, *count, datatype_f2c);
+	fafter
+		add_request_f(__MPI_FILE_IWRITE_ALL, *request, MPI_NONE, NULL);
+
+io MPI_File_seek(MPI_File fh, MPI_Offset offset, int whence)
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *whence, MPI_Fint *ierr
+
+accessory MPI_File_get_position(MPI_File fh, MPI_Offset *offset)
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *ierr
+
+accessory MPI_File_get_byte_offset(MPI_File fh, MPI_Offset offset, MPI_Offset *disp)
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *disp, MPI_Fint *ierr
+
+io MPI_File_read_shared(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_SHARED, count, datatype, 0, 0);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_READ_SHARED, *count, datatype_f2c, 0, 0);
+
+io MPI_File_write_shared(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_SHARED, 0, 0, count, datatype);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_WRITE_SHARED, 0, 0, *count, datatype_f2c);
+
+io MPI_File_iread_shared(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD_SHARED, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD_SHARED, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IREAD_SHARED, *count, datatype_f2c, 0, 0);
+	fafter
+		add_request_f(__MPI_FILE_IREAD_SHARED, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite_shared(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE_SHARED, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE_SHARED, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_IWRITE_SHARED, 0, 0, *count, datatype_f2c);
+	fafter
+		add_request_f(__MPI_FILE_IWRITE_SHARED, *request, MPI_NONE, NULL);
+
+io MPI_File_read_ordered(MPI_File fh, void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_ORDERED, count, datatype, 0, 0);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_READ_ORDERED, *count, datatype_f2c, 0, 0);
+
+io MPI_File_write_ordered(MPI_File fh, const void *buf, int count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_ORDERED, 0, 0, count, datatype);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_WRITE_ORDERED, 0, 0, *count, datatype_f2c);
+
+io MPI_File_seek_shared(MPI_File fh, MPI_Offset offset, int whence)
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *whence, MPI_Fint *ierr
+
+accessory MPI_File_get_position_shared(MPI_File fh, MPI_Offset *offset)
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *ierr
+
+io MPI_File_read_at_all_begin(MPI_File fh, MPI_Offset offset, void *buf, int count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_READ_AT_ALL_BEGIN, count, datatype, 0, 0);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_READ_AT_ALL_BEGIN, *count, datatype_f2c, 0, 0);
+
+io MPI_File_read_at_all_end(MPI_File fh, void *buf, MPI_Status *status)
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *status, MPI_Fint *ierr
+
+io MPI_File_write_at_all_begin(MPI_File fh, MPI_Offset offset, const void *buf, int count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_WRITE_AT_ALL_BEGIN, 0, 0, count, datatype);
+	fortran MPI_Fint *fh, MPI_Fint *offset, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_WRITE_AT_ALL_BEGIN, 0, 0, *count, datatype_f2c);
+
+io MPI_File_write_at_all_end(MPI_File fh, const void *buf, MPI_Status *status)
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *status, MPI_Fint *ierr
+
+io MPI_File_read_all_begin(MPI_File fh, void *buf, int count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_READ_ALL_BEGIN, count, datatype, 0, 0);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_READ_ALL_BEGIN, *count, datatype_f2c, 0, 0);
+
+io MPI_File_read_all_end(MPI_File fh, void *buf, MPI_Status *status)
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *status, MPI_Fint *ierr
+
+io MPI_File_write_all_begin(MPI_File fh, const void *buf, int count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_WRITE_ALL_BEGIN, 0, 0, count, datatype);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_WRITE_ALL_BEGIN, 0, 0, *count, datatype_f2c);
+
+io MPI_File_write_all_end(MPI_File fh, const void *buf, MPI_Status *status)
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *status, MPI_Fint *ierr
+
+io MPI_File_read_ordered_begin(MPI_File fh, void *buf, int count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_READ_ORDERED_BEGIN, count, datatype, 0, 0);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_READ_ORDERED_BEGIN, *count, datatype_f2c, 0, 0);
+
+io MPI_File_read_ordered_end(MPI_File fh, void *buf, MPI_Status *status)
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *status, MPI_Fint *ierr
+
+io MPI_File_write_ordered_begin(MPI_File fh, const void *buf, int count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_WRITE_ORDERED_BEGIN, 0, 0, count, datatype);
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *ierr
+	fbefore
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_file(__MPI_FILE_WRITE_ORDERED_BEGIN, 0, 0, *count, datatype_f2c);
+
+io MPI_File_write_ordered_end(MPI_File fh, const void *buf, MPI_Status *status)
+	fortran MPI_Fint *fh, MPI_Fint *buf, MPI_Fint *status, MPI_Fint *ierr
+
+accessory MPI_File_get_type_extent(MPI_File fh, MPI_Datatype datatype, MPI_Aint *extent)
+	fortran MPI_Fint *fh, MPI_Fint *datatype, MPI_Fint *extent, MPI_Fint *ierr
+
+accessory MPI_File_set_atomicity(MPI_File fh, int flag)
+	fortran MPI_Fint *fh, MPI_Fint *flag, MPI_Fint *ierr
+
+accessory MPI_File_get_atomicity(MPI_File fh, int *flag)
+	fortran MPI_Fint *fh, MPI_Fint *flag, MPI_Fint *ierr
+
+query MPI_Finalized(int *flag)
+	fortran MPI_Fint *flag, MPI_Fint *ierr
+
+accessory MPI_Free_mem(void *base)
+	fortran MPI_Fint *base, MPI_Fint *ierr
+
+collective MPI_Igather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_IGATHER, NULL, NULL, MPI_NONE, &recvcount, &recvtype, MPI_ALL);
+		else
+			add_network(comm, __MPI_IGATHER, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IGATHER, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		if(my_rank == *root)
+		{
+			MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_IGATHER, NULL, NULL, MPI_NONE, recvcount, &recvtype_f2c, MPI_ALL);
+		}
+		else
+		{
+			MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_IGATHER, sendcount, &sendtype_f2c, *root, NULL, NULL, MPI_NONE);
+		}
+	fafter
+		add_request_f(__MPI_IGATHER, *request, MPI_ALL, NULL);
+
+collective MPI_Igatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_IGATHERV, NULL, NULL, MPI_NONE, recvcounts, &recvtype, MPI_ALLV);
+		else
+			add_network(comm, __MPI_IGATHERV, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IGATHERV, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *displs, MPI_Fint *recvtype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		if(my_rank == *root)
+		{
+			MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_IGATHERV, NULL, NULL, MPI_NONE, recvcounts, &recvtype_f2c, MPI_ALLV);
+		}
+		else
+		{
+			MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_IGATHERV, sendcount, &sendtype_f2c, *root, NULL, NULL, MPI_NONE);
+		}
+	fafter
+		add_request_f(__MPI_IGATHERV, *request, MPI_ALL, NULL);
+
+accessory MPI_Get_address(const void *location, MPI_Aint *address)
+	fortran MPI_Fint *location, MPI_Fint *address, MPI_Fint *ierr
+
+accessory MPI_Get_count(const MPI_Status *status, MPI_Datatype datatype, int *count)
+	fortran MPI_Fint *status, MPI_Fint *datatype, MPI_Fint *count, MPI_Fint *ierr
+
+accessory MPI_Get_elements(const MPI_Status *status, MPI_Datatype datatype, int *count)
+	fortran MPI_Fint *status, MPI_Fint *datatype, MPI_Fint *count, MPI_Fint *ierr
+
+accessory MPI_Get_elements_x(const MPI_Status *status, MPI_Datatype datatype, MPI_Count *count)
+	fortran MPI_Fint *status, MPI_Fint *datatype, MPI_Fint *count, MPI_Fint *ierr
+
+rma MPI_Get(void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Win win)
+	fortran MPI_Fint *origin_addr, MPI_Fint *origin_count, MPI_Fint *origin_datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *target_count, MPI_Fint *target_datatype, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Get_accumulate(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, void *result_addr, int result_count, MPI_Datatype result_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win)
+	fortran MPI_Fint *origin_addr, MPI_Fint *origin_count, MPI_Fint *origin_datatype, MPI_Fint *result_addr, MPI_Fint *result_count, MPI_Fint *result_datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *target_count, MPI_Fint *target_datatype, MPI_Fint *op, MPI_Fint *win, MPI_Fint *ierr
+
+accessory MPI_Get_library_version(char *version, int *resultlen)
+	fortran char *version, MPI_Fint *resultlen, MPI_Fint *ierr, size_t version_len
+
+accessory MPI_Get_processor_name(char *name, int *resultlen)
+	fortran char *name, MPI_Fint *resultlen, MPI_Fint *ierr, size_t name_len
+
+accessory MPI_Get_version(int *version, int *subversion)
+	fortran MPI_Fint *version, MPI_Fint *subversion, MPI_Fint *ierr
+
+collective MPI_Graph_create(MPI_Comm comm_old, int nnodes, const int index[], const int edges[], int reorder, MPI_Comm *comm_graph)
+	comm comm_old
+	fortran MPI_Fint *comm_old, MPI_Fint *nnodes, MPI_Fint *index, MPI_Fint *edges, MPI_Fint *reorder, MPI_Fint *comm_graph, MPI_Fint *ierr
+
+accessory MPI_Graph_get(MPI_Comm comm, int maxindex, int maxedges, int index[], int edges[])
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *maxindex, MPI_Fint *maxedges, MPI_Fint *index, MPI_Fint *edges, MPI_Fint *ierr
+
+accessory MPI_Graph_map(MPI_Comm comm, int nnodes, const int index[], const int edges[], int *newrank)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *nnodes, MPI_Fint *index, MPI_Fint *edges, MPI_Fint *newrank, MPI_Fint *ierr
+
+accessory MPI_Graph_neighbors_count(MPI_Comm comm, int rank, int *nneighbors)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *rank, MPI_Fint *nneighbors, MPI_Fint *ierr
+
+accessory MPI_Graph_neighbors(MPI_Comm comm, int rank, int maxneighbors, int neighbors[])
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *rank, MPI_Fint *maxneighbors, MPI_Fint *neighbors, MPI_Fint *ierr
+
+accessory MPI_Graphdims_get(MPI_Comm comm, int *nnodes, int *nedges)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *nnodes, MPI_Fint *nedges, MPI_Fint *ierr
+
+accessory MPI_Grequest_complete(MPI_Request request)
+	fortran MPI_Fint *request, MPI_Fint *ierr
+
+accessory MPI_Grequest_start(MPI_Grequest_query_function *query_fn, MPI_Grequest_free_function *free_fn, MPI_Grequest_cancel_function *cancel_fn, void *extra_state, MPI_Request *request)
+	fortran MPI_Fint *query_fn, MPI_Fint *free_fn, MPI_Fint *cancel_fn, MPI_Fint *extra_state, MPI_Fint *request, MPI_Fint *ierr
+
+accessory MPI_Group_compare(MPI_Group group1, MPI_Group group2, int *result)
+	fortran MPI_Fint *group1, MPI_Fint *group2, MPI_Fint *result, MPI_Fint *ierr
+
+accessory MPI_Group_difference(MPI_Group group1, MPI_Group group2, MPI_Group *newgroup)
+	fortran MPI_Fint *group1, MPI_Fint *group2, MPI_Fint *newgroup, MPI_Fint *ierr
+
+accessory MPI_Group_excl(MPI_Group group, int n, const int ranks[], MPI_Group *newgroup)
+	fortran MPI_Fint *group, MPI_Fint *n, MPI_Fint *ranks, MPI_Fint *newgroup, MPI_Fint *ierr
+
+accessory MPI_Group_free(MPI_Group *group)
+	fortran MPI_Fint *group, MPI_Fint *ierr
+
+accessory MPI_Group_incl(MPI_Group group, int n, const int ranks[], MPI_Group *newgroup)
+	fortran MPI_Fint *group, MPI_Fint *n, MPI_Fint *ranks, MPI_Fint *newgroup, MPI_Fint *ierr
+
+accessory MPI_Group_intersection(MPI_Group group1, MPI_Group group2, MPI_Group *newgroup)
+	fortran MPI_Fint *group1, MPI_Fint *group2, MPI_Fint *newgroup, MPI_Fint *ierr
+
+accessory MPI_Group_range_excl(MPI_Group group, int n, int ranges[][3], MPI_Group *newgroup)
+	fortran MPI_Fint *group, MPI_Fint *n, MPI_Fint ranges[][3], MPI_Fint *newgroup, MPI_Fint *ierr
+
+accessory MPI_Group_range_incl(MPI_Group group, int n, int ranges[][3], MPI_Group *newgroup)
+	fortran MPI_Fint *group, MPI_Fint *n, MPI_Fint ranges[][3], MPI_Fint *newgroup, MPI_Fint *ierr
+
+accessory MPI_Group_rank(MPI_Group group, int *rank)
+	fortran MPI_Fint *group, MPI_Fint *rank, MPI_Fint *ierr
+
+accessory MPI_Group_size(MPI_Group group, int *size)
+	fortran MPI_Fint *group, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_Group_translate_ranks(MPI_Group group1, int n, const int ranks1[], MPI_Group group2, int ranks2[])
+	fortran MPI_Fint *group1, MPI_Fint *n, MPI_Fint *ranks1, MPI_Fint *group2, MPI_Fint *ranks2, MPI_Fint *ierr
+
+accessory MPI_Group_union(MPI_Group group1, MPI_Group group2, MPI_Group *newgroup)
+	fortran MPI_Fint *group1, MPI_Fint *group2, MPI_Fint *newgroup, MPI_Fint *ierr
+
+polling MPI_Improbe(int source, int tag, MPI_Comm comm, int *flag, MPI_Message *message, MPI_Status *status)
+	comm comm
+	after
+		set_poll_result(*flag);
+	fortran MPI_Fint *source, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *flag, MPI_Fint *message, MPI_Fint *status, MPI_Fint *ierr
+	fafter
+		set_poll_result(*flag);
+
+p2p MPI_Imrecv(void *buf, int count, MPI_Datatype type, MPI_Message *message, MPI_Request *request)
+	after
+		add_request(__MPI_IMRECV, *request, MPI_NONE, NULL);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *type, MPI_Fint *message, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_IMRECV, *request, MPI_NONE, NULL);
+
+accessory MPI_Info_create(MPI_Info *info)
+	fortran MPI_Fint *info, MPI_Fint *ierr
+
+accessory MPI_Info_delete(MPI_Info info, const char *key)
+	fortran MPI_Fint *info, char *key, MPI_Fint *ierr, size_t key_len
+
+accessory MPI_Info_dup(MPI_Info info, MPI_Info *newinfo)
+	fortran MPI_Fint *info, MPI_Fint *newinfo, MPI_Fint *ierr
+
+accessory MPI_Info_free(MPI_Info *info)
+	fortran MPI_Fint *info, MPI_Fint *ierr
+
+accessory MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag)
+	fortran MPI_Fint *info, char *key, MPI_Fint *valuelen, char *value, MPI_Fint *flag, MPI_Fint *ierr, size_t key_len, size_t value_len
+
+accessory MPI_Info_get_nkeys(MPI_Info info, int *nkeys)
+	fortran MPI_Fint *info, MPI_Fint *nkeys, MPI_Fint *ierr
+
+accessory MPI_Info_get_nthkey(MPI_Info info, int n, char *key)
+	fortran MPI_Fint *info, MPI_Fint *n, char *key, MPI_Fint *ierr, size_t key_len
+
+accessory MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag)
+	fortran MPI_Fint *info, char *key, MPI_Fint *valuelen, MPI_Fint *flag, MPI_Fint *ierr, size_t key_len
+
+accessory MPI_Info_set(MPI_Info info, const char *key, const char *value)
+	fortran MPI_Fint *info, char *key, char *value, MPI_Fint *ierr, size_t key_len, size_t value_len
+
+query MPI_Initialized(int *flag)
+	fortran MPI_Fint *flag, MPI_Fint *ierr
+
+collective MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm bridge_comm, int remote_leader, int tag, MPI_Comm *newintercomm)
+	comm local_comm
+	fortran MPI_Fint *local_comm, MPI_Fint *local_leader, MPI_Fint *bridge_comm, MPI_Fint *remote_leader, MPI_Fint *tag, MPI_Fint *newintercomm, MPI_Fint *ierr
+
+collective MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintercomm)
+	comm intercomm
+	fortran MPI_Fint *intercomm, MPI_Fint *high, MPI_Fint *newintercomm, MPI_Fint *ierr
+
+accessory MPI_Is_thread_main(int *flag)
+	fortran MPI_Fint *flag, MPI_Fint *ierr
+
+accessory MPI_Lookup_name(const char *service_name, MPI_Info info, char *port_name)
+	eam
+	fortran char *service_name, MPI_Fint *info, char *port_name, MPI_Fint *ierr, size_t service_name_len, size_t port_name_len
+
+wait MPI_Mprobe(int source, int tag, MPI_Comm comm, MPI_Message *message, MPI_Status *status)
+	comm comm
+	fortran MPI_Fint *source, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *message, MPI_Fint *status, MPI_Fint *ierr
+
+p2p MPI_Mrecv(void *buf, int count, MPI_Datatype type, MPI_Message *message, MPI_Status *status)
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *type, MPI_Fint *message, MPI_Fint *status, MPI_Fint *ierr
+
+collective MPI_Ineighbor_allgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLGATHER, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_INEIGHBOR_ALLGATHER, *request, MPI_ALL, NULL);
+
+collective MPI_Ineighbor_allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLGATHERV, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *displs, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_INEIGHBOR_ALLGATHERV, *request, MPI_ALL, NULL);
+
+collective MPI_Ineighbor_alltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLTOALL, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_INEIGHBOR_ALLTOALL, *request, MPI_ALL, NULL);
+
+collective MPI_Ineighbor_alltoallv(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLTOALLV, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *sdispls, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *rdispls, MPI_Fint *recvtype, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_INEIGHBOR_ALLTOALLV, *request, MPI_ALL, NULL);
+
+collective MPI_Ineighbor_alltoallw(const void *sendbuf, const int sendcounts[], const MPI_Aint sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const MPI_Aint rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLTOALLW, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *sdispls, MPI_Fint *sendtypes, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *rdispls, MPI_Fint *recvtypes, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_INEIGHBOR_ALLTOALLW, *request, MPI_ALL, NULL);
+
+accessory MPI_Op_commutative(MPI_Op op, int *commute)
+	fortran MPI_Fint *op, MPI_Fint *commute, MPI_Fint *ierr
+
+accessory MPI_Op_create(MPI_User_function *function, int commute, MPI_Op *op)
+	fortran MPI_Fint *function, MPI_Fint *commute, MPI_Fint *op, MPI_Fint *ierr
+
+accessory MPI_Open_port(MPI_Info info, char *port_name)
+	fortran MPI_Fint *info, char *port_name, MPI_Fint *ierr, size_t port_name_len
+
+accessory MPI_Op_free(MPI_Op *op)
+	fortran MPI_Fint *op, MPI_Fint *ierr
+
+accessory MPI_Pack_external(const char datarep[], const void *inbuf, int incount, MPI_Datatype datatype, void *outbuf, MPI_Aint outsize, MPI_Aint *position)
+	fortran char *datarep, MPI_Fint *inbuf, MPI_Fint *incount, MPI_Fint *datatype, MPI_Fint *outbuf, MPI_Fint *outsize, MPI_Fint *position, MPI_Fint *ierr, size_t datarep_len
+
+accessory MPI_Pack_external_size(const char datarep[], int incount, MPI_Datatype datatype, MPI_Aint *size)
+	fortran char *datarep, MPI_Fint *incount, MPI_Fint *datatype, MPI_Fint *size, MPI_Fint *ierr, size_t datarep_len
+
+accessory MPI_Pack(const void *inbuf, int incount, MPI_Datatype datatype, void *outbuf, int outsize, int *position, MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *inbuf, MPI_Fint *incount, MPI_Fint *datatype, MPI_Fint *outbuf, MPI_Fint *outsize, MPI_Fint *position, MPI_Fint *comm, MPI_Fint *ierr
+
+accessory MPI_Pack_size(int incount, MPI_Datatype datatype, MPI_Comm comm, int *size)
+	comm comm
+	fortran MPI_Fint *incount, MPI_Fint *datatype, MPI_Fint *comm, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_Pcontrol(const int level, ...)
+	fortran MPI_Fint *level, MPI_Fint *ierr
+
+accessory MPI_Publish_name(const char *service_name, MPI_Info info, const char *port_name)
+	eam
+	fortran char *service_name, MPI_Fint *info, char *port_name, MPI_Fint *ierr, size_t service_name_len, size_t port_name_len
+
+rma MPI_Put(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Win win)
+	fortran MPI_Fint *origin_addr, MPI_Fint *origin_count, MPI_Fint *origin_datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *target_count, MPI_Fint *target_datatype, MPI_Fint *win, MPI_Fint *ierr
+
+accessory MPI_Query_thread(int *provided)
+	fortran MPI_Fint *provided, MPI_Fint *ierr
+
+rma MPI_Raccumulate(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win, MPI_Request *request)
+	after
+		add_request(__MPI_RACCUMULATE, *request, target_rank, NULL);
+	fortran MPI_Fint *origin_addr, MPI_Fint *origin_count, MPI_Fint *origin_datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *target_count, MPI_Fint *target_datatype, MPI_Fint *op, MPI_Fint *win, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_RACCUMULATE, *request, *target_rank, NULL);
+
+p2p MPI_Recv_init(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent(comm, __MPI_RECV_INIT, NULL, NULL, MPI_NONE, &count, &datatype, source, start_data);
+	after
+		add_request_p2p_init(__MPI_RECV_INIT, comm, *request, source, start_data);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *source, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		uint64_t start_data[2];
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network_persistent(MPI_Comm_f2c(*comm), __MPI_RECV_INIT, NULL, NULL, MPI_NONE, count, &datatype_f2c, *source, start_data);
+	fafter
+		add_request_p2p_init_f(__MPI_RECV_INIT, *comm, *request, *source, start_data);
+
+collective MPI_Ireduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_IREDUCE, NULL, NULL, MPI_NONE, &count, &datatype, MPI_ALL);
+		else
+			add_network(comm, __MPI_IREDUCE, &count, &datatype, root, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IREDUCE, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		if(my_rank == *root)
+			add_network(MPI_Comm_f2c(*comm), __MPI_IREDUCE, NULL, NULL, MPI_NONE, count, &datatype_f2c, MPI_ALL);
+		else
+			add_network(MPI_Comm_f2c(*comm), __MPI_IREDUCE, count, &datatype_f2c, *root, NULL, NULL, MPI_NONE);
+	fafter
+		add_request_f(__MPI_IREDUCE, *request, MPI_ALL, NULL);
+
+accessory MPI_Reduce_local(const void *inbuf, void *inoutbuf, int count, MPI_Datatype datatype, MPI_Op op)
+	fortran MPI_Fint *inbuf, MPI_Fint *inoutbuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *ierr
+
+collective MPI_Ireduce_scatter(const void *sendbuf, void *recvbuf, const int recvcounts[], MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network(comm, __MPI_IREDUCE_SCATTER, recvcounts, &datatype, MPI_ALLV, recvcounts, &datatype, MPI_ALLV);
+		else
+			add_network(comm, __MPI_IREDUCE_SCATTER, &recvcounts[my_rank], &datatype, 0, &recvcounts[my_rank], &datatype, 0);
+	after
+		add_request(__MPI_IREDUCE_SCATTER, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *recvcounts, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		if(my_rank == 0)
+			add_network(MPI_Comm_f2c(*comm), __MPI_IREDUCE_SCATTER, recvcounts, &datatype_f2c, MPI_ALLV, recvcounts, &datatype_f2c, MPI_ALLV);
+		else
+			add_network(MPI_Comm_f2c(*comm), __MPI_IREDUCE_SCATTER, &recvcounts[my_rank], &datatype_f2c, 0, &recvcounts[my_rank], &datatype_f2c, 0);
+	fafter
+		add_request_f(__MPI_IREDUCE_SCATTER, *request, MPI_ALL, NULL);
+
+collective MPI_Reduce_scatter_block(const void *sendbuf, void *recvbuf, int recvcount, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network(comm, __MPI_REDUCE_SCATTER_BLOCK, &recvcount, &datatype, MPI_ALL, &recvcount, &datatype, MPI_ALLV);
+		else
+			add_network(comm, __MPI_REDUCE_SCATTER_BLOCK, &recvcount, &datatype, 0, &recvcount, &datatype, 0);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		if(my_rank == 0)
+			add_network(MPI_Comm_f2c(*comm), __MPI_REDUCE_SCATTER_BLOCK, recvcount, &datatype_f2c, MPI_ALL, recvcount, &datatype_f2c, MPI_ALLV);
+		else
+			add_network(MPI_Comm_f2c(*comm), __MPI_REDUCE_SCATTER_BLOCK, recvcount, &datatype_f2c, 0, recvcount, &datatype_f2c, 0);
+
+collective MPI_Ireduce_scatter_block(const void *sendbuf, void *recvbuf, int recvcount, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network(comm, __MPI_IREDUCE_SCATTER_BLOCK, &recvcount, &datatype, MPI_ALL, &recvcount, &datatype, MPI_ALLV);
+		else
+			add_network(comm, __MPI_IREDUCE_SCATTER_BLOCK, &recvcount, &datatype, 0, &recvcount, &datatype, 0);
+	after
+		add_request(__MPI_IREDUCE_SCATTER_BLOCK, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		if(my_rank == 0)
+			add_network(MPI_Comm_f2c(*comm), __MPI_IREDUCE_SCATTER_BLOCK, recvcount, &datatype_f2c, MPI_ALL, recvcount, &datatype_f2c, MPI_ALLV);
+		else
+			add_network(MPI_Comm_f2c(*comm), __MPI_IREDUCE_SCATTER_BLOCK, recvcount, &datatype_f2c, 0, recvcount, &datatype_f2c, 0);
+	fafter
+		add_request_f(__MPI_IREDUCE_SCATTER_BLOCK, *request, MPI_ALL, NULL);
+
+accessory MPI_Register_datarep(const char *datarep, MPI_Datarep_conversion_function *read_conversion_fn, MPI_Datarep_conversion_function *write_conversion_fn, MPI_Datarep_extent_function *dtype_file_extent_fn, void *extra_state)
+	fortran char *datarep, MPI_Fint *read_conversion_fn, MPI_Fint *write_conversion_fn, MPI_Fint *dtype_file_extent_fn, MPI_Fint *extra_state, MPI_Fint *ierr, size_t datarep_len
+
+accessory MPI_Request_free(MPI_Request *request)
+	before
+		free_request(*request);
+	fortran MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		free_request_f(*request);
+
+polling MPI_Request_get_status(MPI_Request request, int *flag, MPI_Status *status)
+	after
+		set_poll_result(*flag);
+	fortran MPI_Fint *request, MPI_Fint *flag, MPI_Fint *status, MPI_Fint *ierr
+	fafter
+		set_poll_result(*flag);
+
+rma MPI_Rget(void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Win win, MPI_Request *request)
+	after
+		add_request(__MPI_RGET, *request, target_rank, NULL);
+	fortran MPI_Fint *origin_addr, MPI_Fint *origin_count, MPI_Fint *origin_datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *target_count, MPI_Fint *target_datatype, MPI_Fint *win, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_RGET, *request, *target_rank, NULL);
+
+rma MPI_Rget_accumulate(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, void *result_addr, int result_count, MPI_Datatype result_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win, MPI_Request *request)
+	after
+		add_request(__MPI_RGET_ACCUMULATE, *request, target_rank, NULL);
+	fortran MPI_Fint *origin_addr, MPI_Fint *origin_count, MPI_Fint *origin_datatype, MPI_Fint *result_addr, MPI_Fint *result_count, MPI_Fint *result_datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *target_count, MPI_Fint *target_datatype, MPI_Fint *op, MPI_Fint *win, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_RGET_ACCUMULATE, *request, *target_rank, NULL);
+
+rma MPI_Rput(const void *origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, int target_count, MPI_Datatype target_datatype, MPI_Win win, MPI_Request *request)
+	after
+		add_request(__MPI_RPUT, *request, target_rank, NULL);
+	fortran MPI_Fint *origin_addr, MPI_Fint *origin_count, MPI_Fint *origin_datatype, MPI_Fint *target_rank, MPI_Fint *target_disp, MPI_Fint *target_count, MPI_Fint *target_datatype, MPI_Fint *win, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_RPUT, *request, *target_rank, NULL);
+
+p2p MPI_Rsend_init(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent(comm, __MPI_RSEND_INIT, &count, &datatype, dest, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request_p2p_init(__MPI_RSEND_INIT, comm, *request, dest, start_data);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		uint64_t start_data[2];
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network_persistent(MPI_Comm_f2c(*comm), __MPI_RSEND_INIT, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE, start_data);
+	fafter
+		add_request_p2p_init_f(__MPI_RSEND_INIT, *comm, *request, *dest, start_data);
+
+collective MPI_Iscan(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_ISCAN, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *recvbuf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *op, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		add_request_f(__MPI_ISCAN, *request, MPI_ALL, NULL);
+
+collective MPI_Iscatter(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_ISCATTER, &sendcount, &sendtype, MPI_ALL, NULL, NULL, MPI_NONE);
+		else
+			add_network(comm, __MPI_ISCATTER, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root);
+	after
+		add_request(__MPI_ISCATTER, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcount, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		if(my_rank == *root)
+		{
+			MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_ISCATTER, sendcount, &sendtype_f2c, MPI_ALL, NULL, NULL, MPI_NONE);
+		}
+		else
+		{
+			MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_ISCATTER, NULL, NULL, MPI_NONE, recvcount, &recvtype_f2c, *root);
+		}
+	fafter
+		add_request_f(__MPI_ISCATTER, *request, MPI_ALL, NULL);
+
+collective MPI_Iscatterv(const void *sendbuf, const int sendcounts[], const int displs[], MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network(comm, __MPI_ISCATTERV, sendcounts, &sendtype, MPI_ALLV, NULL, NULL, MPI_NONE);
+		else
+			add_network(comm, __MPI_ISCATTERV, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root);
+	after
+		add_request(__MPI_ISCATTERV, *request, MPI_ALL, NULL);
+	fortran MPI_Fint *sendbuf, MPI_Fint *sendcounts, MPI_Fint *displs, MPI_Fint *sendtype, MPI_Fint *recvbuf, MPI_Fint *recvcount, MPI_Fint *recvtype, MPI_Fint *root, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		int my_rank;
+		PMPI_Comm_rank(MPI_Comm_f2c(*comm), &my_rank);
+		if(my_rank == *root)
+		{
+			MPI_Datatype sendtype_f2c = MPI_Type_f2c(*sendtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_ISCATTERV, sendcounts, &sendtype_f2c, MPI_ALLV, NULL, NULL, MPI_NONE);
+		}
+		else
+		{
+			MPI_Datatype recvtype_f2c = MPI_Type_f2c(*recvtype);
+			add_network(MPI_Comm_f2c(*comm), __MPI_ISCATTERV, NULL, NULL, MPI_NONE, recvcount, &recvtype_f2c, *root);
+		}
+	fafter
+		add_request_f(__MPI_ISCATTERV, *request, MPI_ALL, NULL);
+
+p2p MPI_Send_init(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent(comm, __MPI_SEND_INIT, &count, &datatype, dest, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request_p2p_init(__MPI_SEND_INIT, comm, *request, dest, start_data);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		uint64_t start_data[2];
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network_persistent(MPI_Comm_f2c(*comm), __MPI_SEND_INIT, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE, start_data);
+	fafter
+		add_request_p2p_init_f(__MPI_SEND_INIT, *comm, *request, *dest, start_data);
+
+p2p MPI_Ssend_init(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent(comm, __MPI_SSEND_INIT, &count, &datatype, dest, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request_p2p_init(__MPI_SSEND_INIT, comm, *request, dest, start_data);
+	fortran MPI_Fint *buf, MPI_Fint *count, MPI_Fint *datatype, MPI_Fint *dest, MPI_Fint *tag, MPI_Fint *comm, MPI_Fint *request, MPI_Fint *ierr
+	fbefore
+		uint64_t start_data[2];
+		MPI_Datatype datatype_f2c = MPI_Type_f2c(*datatype);
+		add_network_persistent(MPI_Comm_f2c(*comm), __MPI_SSEND_INIT, count, &datatype_f2c, *dest, NULL, NULL, MPI_NONE, start_data);
+	fafter
+		add_request_p2p_init_f(__MPI_SSEND_INIT, *comm, *request, *dest, start_data);
+
+p2p MPI_Start(MPI_Request *request)
+	after
+		start_requests(1, request);
+	fortran MPI_Fint *request, MPI_Fint *ierr
+	fafter
+		start_requests_f(1, request);
+
+p2p MPI_Startall(int count, MPI_Request array_of_requests[])
+	after
+		start_requests(count, array_of_requests);
+	fortran MPI_Fint *count, MPI_Fint *array_of_requests, MPI_Fint *ierr
+	fafter
+		start_requests_f(*count, array_of_requests);
+
+accessory MPI_Status_set_cancelled(MPI_Status *status, int flag)
+	fortran MPI_Fint *status, MPI_Fint *flag, MPI_Fint *ierr
+
+accessory MPI_Status_set_elements(MPI_Status *status, MPI_Datatype datatype, int count)
+	fortran MPI_Fint *status, MPI_Fint *datatype, MPI_Fint *count, MPI_Fint *ierr
+
+accessory MPI_Status_set_elements_x(MPI_Status *status, MPI_Datatype datatype, MPI_Count count)
+	fortran MPI_Fint *status, MPI_Fint *datatype, MPI_Fint *count, MPI_Fint *ierr
+
+polling MPI_Testall(int count, MPI_Request array_of_requests[], int *flag, MPI_Status array_of_statuses[])
+	before
+		MPI_Request *saved_requests = save_requests(count, array_of_requests);
+	after
+		if(*flag)
+			complete_requests(count, saved_requests, NULL, 0);
+		set_poll_result(*flag);
+	fortran MPI_Fint *count, MPI_Fint *array_of_requests, MPI_Fint *flag, MPI_Fint *array_of_statuses, MPI_Fint *ierr
+	fbefore
+		MPI_Request *saved_requests = save_requests_f(*count, array_of_requests);
+	fafter
+		if(*flag)
+			complete_requests(*count, saved_requests, NULL, 0);
+		set_poll_result(*flag);
+
+polling MPI_Testany(int count, MPI_Request array_of_requests[], int *index, int *flag, MPI_Status *status)
+	before
+		MPI_Request *saved_requests = save_requests(count, array_of_requests);
+	after
+		if(*flag)
+			complete_requests(1, saved_requests, index, 0);
+		set_poll_result(*flag);
+	fortran MPI_Fint *count, MPI_Fint *array_of_requests, MPI_Fint *index, MPI_Fint *flag, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Request *saved_requests = save_requests_f(*count, array_of_requests);
+	fafter
+		if(*flag)
+			complete_requests(1, saved_requests, index, 1);
+		set_poll_result(*flag);
+
+polling MPI_Test(MPI_Request *request, int *flag, MPI_Status *status)
+	before
+		MPI_Request *saved_requests = save_requests(1, request);
+	after
+		if(*flag)
+			complete_requests(1, saved_requests, NULL, 0);
+		set_poll_result(*flag);
+	fortran MPI_Fint *request, MPI_Fint *flag, MPI_Fint *status, MPI_Fint *ierr
+	fbefore
+		MPI_Request *saved_requests = save_requests_f(1, request);
+	fafter
+		if(*flag)
+			complete_requests(1, saved_requests, NULL, 0);
+		set_poll_result(*flag);
+
+accessory MPI_Test_cancelled(const MPI_Status *status, int *flag)
+	fortran MPI_Fint *status, MPI_Fint *flag, MPI_Fint *ierr
+
+polling MPI_Testsome(int incount, MPI_Request array_of_requests[], int *outcount, int array_of_indices[], MPI_Status array_of_statuses[])
+	before
+		MPI_Request *saved_requests = save_requests(incount, array_of_requests);
+	after
+		complete_requests(*outcount, saved_requests, array_of_indices, 0);
+		set_poll_result(*outcount != 0);
+	fortran MPI_Fint *incount, MPI_Fint *array_of_requests, MPI_Fint *outcount, MPI_Fint *array_of_indices, MPI_Fint *array_of_statuses, MPI_Fint *ierr
+	fbefore
+		MPI_Request *saved_requests = save_requests_f(*incount, array_of_requests);
+	fafter
+		complete_requests(*outcount, saved_requests, array_of_indices, 1);
+		set_poll_result(*outcount != 0);
+
+accessory MPI_Topo_test(MPI_Comm comm, int *status)
+	comm comm
+	fortran MPI_Fint *comm, MPI_Fint *status, MPI_Fint *ierr
+
+accessory MPI_Type_commit(MPI_Datatype *type)
+	fortran MPI_Fint *type, MPI_Fint *ierr
+
+accessory MPI_Type_contiguous(int count, MPI_Datatype oldtype, MPI_Datatype *newtype)
+	fortran MPI_Fint *count, MPI_Fint *oldtype, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_darray(int size, int rank, int ndims, const int gsize_array[], const int distrib_array[], const int darg_array[], const int psize_array[], int order, MPI_Datatype oldtype, MPI_Datatype *newtype)
+	fortran MPI_Fint *size, MPI_Fint *rank, MPI_Fint *ndims, MPI_Fint *gsize_array, MPI_Fint *distrib_array, MPI_Fint *darg_array, MPI_Fint *psize_array, MPI_Fint *order, MPI_Fint *oldtype, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_f90_complex(int p, int r, MPI_Datatype *newtype)
+	fortran MPI_Fint *p, MPI_Fint *r, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_f90_integer(int r, MPI_Datatype *newtype)
+	fortran MPI_Fint *r, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_f90_real(int p, int r, MPI_Datatype *newtype)
+	fortran MPI_Fint *p, MPI_Fint *r, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_hindexed_block(int count, int blocklength, const MPI_Aint array_of_displacements[], MPI_Datatype oldtype, MPI_Datatype *newtype)
+	fortran MPI_Fint *count, MPI_Fint *blocklength, MPI_Fint *array_of_displacements, MPI_Fint *oldtype, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_hindexed(int count, const int array_of_blocklengths[], const MPI_Aint array_of_displacements[], MPI_Datatype oldtype, MPI_Datatype *newtype)
+	fortran MPI_Fint *count, MPI_Fint *array_of_blocklengths, MPI_Fint *array_of_displacements, MPI_Fint *oldtype, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_hvector(int count, int blocklength, MPI_Aint stride, MPI_Datatype oldtype, MPI_Datatype *newtype)
+	fortran MPI_Fint *count, MPI_Fint *blocklength, MPI_Fint *stride, MPI_Fint *oldtype, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_keyval(MPI_Type_copy_attr_function *type_copy_attr_fn, MPI_Type_delete_attr_function *type_delete_attr_fn, int *type_keyval, void *extra_state)
+	fortran MPI_Fint *type_copy_attr_fn, MPI_Fint *type_delete_attr_fn, MPI_Fint *type_keyval, MPI_Fint *extra_state, MPI_Fint *ierr
+
+accessory MPI_Type_create_indexed_block(int count, int blocklength, const int array_of_displacements[], MPI_Datatype oldtype, MPI_Datatype *newtype)
+	fortran MPI_Fint *count, MPI_Fint *blocklength, MPI_Fint *array_of_displacements, MPI_Fint *oldtype, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_struct(int count, const int array_of_block_lengths[], const MPI_Aint array_of_displacements[], const MPI_Datatype array_of_types[], MPI_Datatype *newtype)
+	fortran MPI_Fint *count, MPI_Fint *array_of_block_lengths, MPI_Fint *array_of_displacements, MPI_Fint *array_of_types, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_subarray(int ndims, const int size_array[], const int subsize_array[], const int start_array[], int order, MPI_Datatype oldtype, MPI_Datatype *newtype)
+	fortran MPI_Fint *ndims, MPI_Fint *size_array, MPI_Fint *subsize_array, MPI_Fint *start_array, MPI_Fint *order, MPI_Fint *oldtype, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_create_resized(MPI_Datatype oldtype, MPI_Aint lb, MPI_Aint extent, MPI_Datatype *newtype)
+	fortran MPI_Fint *oldtype, MPI_Fint *lb, MPI_Fint *extent, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_delete_attr(MPI_Datatype type, int type_keyval)
+	fortran MPI_Fint *type, MPI_Fint *type_keyval, MPI_Fint *ierr
+
+accessory MPI_Type_dup(MPI_Datatype type, MPI_Datatype *newtype)
+	fortran MPI_Fint *type, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_free(MPI_Datatype *type)
+	fortran MPI_Fint *type, MPI_Fint *ierr
+
+accessory MPI_Type_free_keyval(int *type_keyval)
+	fortran MPI_Fint *type_keyval, MPI_Fint *ierr
+
+accessory MPI_Type_get_attr(MPI_Datatype type, int type_keyval, void *attribute_val, int *flag)
+	fortran MPI_Fint *type, MPI_Fint *type_keyval, MPI_Fint *attribute_val, MPI_Fint *flag, MPI_Fint *ierr
+
+accessory MPI_Type_get_contents(MPI_Datatype mtype, int max_integers, int max_addresses, int max_datatypes, int array_of_integers[], MPI_Aint array_of_addresses[], MPI_Datatype array_of_datatypes[])
+	fortran MPI_Fint *mtype, MPI_Fint *max_integers, MPI_Fint *max_addresses, MPI_Fint *max_datatypes, MPI_Fint *array_of_integers, MPI_Fint *array_of_addresses, MPI_Fint *array_of_datatypes, MPI_Fint *ierr
+
+accessory MPI_Type_get_envelope(MPI_Datatype type, int *num_integers, int *num_addresses, int *num_datatypes, int *combiner)
+	fortran MPI_Fint *type, MPI_Fint *num_integers, MPI_Fint *num_addresses, MPI_Fint *num_datatypes, MPI_Fint *combiner, MPI_Fint *ierr
+
+accessory MPI_Type_get_extent(MPI_Datatype type, MPI_Aint *lb, MPI_Aint *extent)
+	fortran MPI_Fint *type, MPI_Fint *lb, MPI_Fint *extent, MPI_Fint *ierr
+
+accessory MPI_Type_get_extent_x(MPI_Datatype type, MPI_Count *lb, MPI_Count *extent)
+	fortran MPI_Fint *type, MPI_Fint *lb, MPI_Fint *extent, MPI_Fint *ierr
+
+accessory MPI_Type_get_name(MPI_Datatype type, char *type_name, int *resultlen)
+	fortran MPI_Fint *type, char *type_name, MPI_Fint *resultlen, MPI_Fint *ierr, size_t type_name_len
+
+accessory MPI_Type_get_true_extent(MPI_Datatype datatype, MPI_Aint *true_lb, MPI_Aint *true_extent)
+	fortran MPI_Fint *datatype, MPI_Fint *true_lb, MPI_Fint *true_extent, MPI_Fint *ierr
+
+accessory MPI_Type_get_true_extent_x(MPI_Datatype datatype, MPI_Count *true_lb, MPI_Count *true_extent)
+	fortran MPI_Fint *datatype, MPI_Fint *true_lb, MPI_Fint *true_extent, MPI_Fint *ierr
+
+accessory MPI_Type_indexed(int count, const int array_of_blocklengths[], const int array_of_displacements[], MPI_Datatype oldtype, MPI_Datatype *newtype)
+	fortran MPI_Fint *count, MPI_Fint *array_of_blocklengths, MPI_Fint *array_of_displacements, MPI_Fint *oldtype, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Type_match_size(int typeclass, int size, MPI_Datatype *type)
+	fortran MPI_Fint *typeclass, MPI_Fint *size, MPI_Fint *type, MPI_Fint *ierr
+
+accessory MPI_Type_set_attr(MPI_Datatype type, int type_keyval, void *attr_val)
+	fortran MPI_Fint *type, MPI_Fint *type_keyval, MPI_Fint *attr_val, MPI_Fint *ierr
+
+accessory MPI_Type_set_name(MPI_Datatype type, const char *type_name)
+	fortran MPI_Fint *type, char *type_name, MPI_Fint *ierr, size_t type_name_len
+
+accessory MPI_Type_size(MPI_Datatype type, int *size)
+	fortran MPI_Fint *type, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_Type_size_x(MPI_Datatype type, MPI_Count *size)
+	fortran MPI_Fint *type, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_Type_vector(int count, int blocklength, int stride, MPI_Datatype oldtype, MPI_Datatype *newtype)
+	fortran MPI_Fint *count, MPI_Fint *blocklength, MPI_Fint *stride, MPI_Fint *oldtype, MPI_Fint *newtype, MPI_Fint *ierr
+
+accessory MPI_Unpack(const void *inbuf, int insize, int *position, void *outbuf, int outcount, MPI_Datatype datatype, MPI_Comm comm)
+	comm comm
+	fortran MPI_Fint *inbuf, MPI_Fint *insize, MPI_Fint *position, MPI_Fint *outbuf, MPI_Fint *outcount, MPI_Fint *datatype, MPI_Fint *comm, MPI_Fint *ierr
+
+accessory MPI_Unpublish_name(const char *service_name, MPI_Info info, const char *port_name)
+	eam
+	fortran char *service_name, MPI_Fint *info, char *port_name, MPI_Fint *ierr, size_t service_name_len, size_t port_name_len
+
+accessory MPI_Unpack_external(const char datarep[], const void *inbuf, MPI_Aint insize, MPI_Aint *position, void *outbuf, int outcount, MPI_Datatype datatype)
+	fortran char *datarep, MPI_Fint *inbuf, MPI_Fint *insize, MPI_Fint *position, MPI_Fint *outbuf, MPI_Fint *outcount, MPI_Fint *datatype, MPI_Fint *ierr, size_t datarep_len
+
+rma MPI_Win_allocate(MPI_Aint size, int disp_unit, MPI_Info info, MPI_Comm comm, void *baseptr, MPI_Win *win)
+	comm comm
+	fortran MPI_Fint *size, MPI_Fint *disp_unit, MPI_Fint *info, MPI_Fint *comm, MPI_Fint *baseptr, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_allocate_shared(MPI_Aint size, int disp_unit, MPI_Info info, MPI_Comm comm, void *baseptr, MPI_Win *win)
+	comm comm
+	fortran MPI_Fint *size, MPI_Fint *disp_unit, MPI_Fint *info, MPI_Fint *comm, MPI_Fint *baseptr, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_attach(MPI_Win win, void *base, MPI_Aint size)
+	fortran MPI_Fint *win, MPI_Fint *base, MPI_Fint *size, MPI_Fint *ierr
+
+accessory MPI_Win_call_errhandler(MPI_Win win, int errorcode)
+	fortran MPI_Fint *win, MPI_Fint *errorcode, MPI_Fint *ierr
+
+rma MPI_Win_complete(MPI_Win win)
+	fortran MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_create(void *base, MPI_Aint size, int disp_unit, MPI_Info info, MPI_Comm comm, MPI_Win *win)
+	comm comm
+	fortran MPI_Fint *base, MPI_Fint *size, MPI_Fint *disp_unit, MPI_Fint *info, MPI_Fint *comm, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_create_dynamic(MPI_Info info, MPI_Comm comm, MPI_Win *win)
+	comm comm
+	fortran MPI_Fint *info, MPI_Fint *comm, MPI_Fint *win, MPI_Fint *ierr
+
+accessory MPI_Win_create_errhandler(MPI_Win_errhandler_function *function, MPI_Errhandler *errhandler)
+	fortran MPI_Fint *function, MPI_Fint *errhandler, MPI_Fint *ierr
+
+accessory MPI_Win_create_keyval(MPI_Win_copy_attr_function *win_copy_attr_fn, MPI_Win_delete_attr_function *win_delete_attr_fn, int *win_keyval, void *extra_state)
+	fortran MPI_Fint *win_copy_attr_fn, MPI_Fint *win_delete_attr_fn, MPI_Fint *win_keyval, MPI_Fint *extra_state, MPI_Fint *ierr
+
+accessory MPI_Win_delete_attr(MPI_Win win, int win_keyval)
+	fortran MPI_Fint *win, MPI_Fint *win_keyval, MPI_Fint *ierr
+
+rma MPI_Win_detach(MPI_Win win, const void *base)
+	fortran MPI_Fint *win, MPI_Fint *base, MPI_Fint *ierr
+
+rma MPI_Win_fence(int assert, MPI_Win win)
+	fortran MPI_Fint *assert, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_free(MPI_Win *win)
+	fortran MPI_Fint *win, MPI_Fint *ierr
+
+accessory MPI_Win_free_keyval(int *win_keyval)
+	fortran MPI_Fint *win_keyval, MPI_Fint *ierr
+
+accessory MPI_Win_get_attr(MPI_Win win, int win_keyval, void *attribute_val, int *flag)
+	fortran MPI_Fint *win, MPI_Fint *win_keyval, MPI_Fint *attribute_val, MPI_Fint *flag, MPI_Fint *ierr
+
+accessory MPI_Win_get_errhandler(MPI_Win win, MPI_Errhandler *errhandler)
+	fortran MPI_Fint *win, MPI_Fint *errhandler, MPI_Fint *ierr
+
+accessory MPI_Win_get_group(MPI_Win win, MPI_Group *group)
+	fortran MPI_Fint *win, MPI_Fint *group, MPI_Fint *ierr
+
+accessory MPI_Win_get_info(MPI_Win win, MPI_Info *info_used)
+	fortran MPI_Fint *win, MPI_Fint *info_used, MPI_Fint *ierr
+
+accessory MPI_Win_get_name(MPI_Win win, char *win_name, int *resultlen)
+	fortran MPI_Fint *win, char *win_name, MPI_Fint *resultlen, MPI_Fint *ierr, size_t win_name_len
+
+rma MPI_Win_post(MPI_Group group, int assert, MPI_Win win)
+	fortran MPI_Fint *group, MPI_Fint *assert, MPI_Fint *win, MPI_Fint *ierr
+
+accessory MPI_Win_set_attr(MPI_Win win, int win_keyval, void *attribute_val)
+	fortran MPI_Fint *win, MPI_Fint *win_keyval, MPI_Fint *attribute_val, MPI_Fint *ierr
+
+accessory MPI_Win_set_errhandler(MPI_Win win, MPI_Errhandler errhandler)
+	fortran MPI_Fint *win, MPI_Fint *errhandler, MPI_Fint *ierr
+
+accessory MPI_Win_set_info(MPI_Win win, MPI_Info info)
+	fortran MPI_Fint *win, MPI_Fint *info, MPI_Fint *ierr
+
+accessory MPI_Win_set_name(MPI_Win win, const char *win_name)
+	fortran MPI_Fint *win, char *win_name, MPI_Fint *ierr, size_t win_name_len
+
+accessory MPI_Win_shared_query(MPI_Win win, int rank, MPI_Aint *size, int *disp_unit, void *baseptr)
+	fortran MPI_Fint *win, MPI_Fint *rank, MPI_Fint *size, MPI_Fint *disp_unit, MPI_Fint *baseptr, MPI_Fint *ierr
+
+rma MPI_Win_start(MPI_Group group, int assert, MPI_Win win)
+	fortran MPI_Fint *group, MPI_Fint *assert, MPI_Fint *win, MPI_Fint *ierr
+
+polling MPI_Win_test(MPI_Win win, int *flag)
+	after
+		set_poll_result(*flag);
+	fortran MPI_Fint *win, MPI_Fint *flag, MPI_Fint *ierr
+	fafter
+		set_poll_result(*flag);
+
+rma MPI_Win_unlock(int rank, MPI_Win win)
+	fortran MPI_Fint *rank, MPI_Fint *win, MPI_Fint *ierr
+
+rma MPI_Win_unlock_all(MPI_Win win)
+	fortran MPI_Fint *win, MPI_Fint *ierr
+
+section persistent
+
+// MPI-4 persistent collectives: the bytes are computed once here and
+// accounted to the collective at every MPI_Start of the request
+collective MPI_Allgather_init(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		add_network_persistent(comm, __MPI_ALLGATHER_INIT, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL, start_data);
+	after
+		add_request(__MPI_ALLGATHER_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Allgatherv_init(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		add_network_persistent(comm, __MPI_ALLGATHERV_INIT, &sendcount, &sendtype, MPI_ALL, recvcounts, &recvtype, MPI_ALLV, start_data);
+	after
+		add_request(__MPI_ALLGATHERV_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Allreduce_init(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		add_network_persistent(comm, __MPI_ALLREDUCE_INIT, &count, &datatype, MPI_ALL, &count, &datatype, MPI_ALL, start_data);
+	after
+		add_request(__MPI_ALLREDUCE_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Alltoall_init(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		add_network_persistent(comm, __MPI_ALLTOALL_INIT, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL, start_data);
+	after
+		add_request(__MPI_ALLTOALL_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Alltoallv_init(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		add_network_persistent(comm, __MPI_ALLTOALLV_INIT, sendcounts, &sendtype, MPI_ALLV, recvcounts, &recvtype, MPI_ALLV, start_data);
+	after
+		add_request(__MPI_ALLTOALLV_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Alltoallw_init(const void *sendbuf, const int sendcounts[], const int sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const int rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		add_network_persistent(comm, __MPI_ALLTOALLW_INIT, sendcounts, (MPI_Datatype*) sendtypes, MPI_ALLW, recvcounts, (MPI_Datatype*) recvtypes, MPI_ALLW, start_data);
+	after
+		add_request(__MPI_ALLTOALLW_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Barrier_init(MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+	after
+		add_request(__MPI_BARRIER_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Bcast_init(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_persistent(comm, __MPI_BCAST_INIT, &count, &datatype, MPI_ALL, NULL, NULL, MPI_NONE, start_data);
+		else
+			add_network_persistent(comm, __MPI_BCAST_INIT, NULL, NULL, MPI_NONE, &count, &datatype, root, start_data);
+	after
+		add_request(__MPI_BCAST_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Exscan_init(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+	after
+		add_request(__MPI_EXSCAN_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Gather_init(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_persistent(comm, __MPI_GATHER_INIT, NULL, NULL, MPI_NONE, &recvcount, &recvtype, MPI_ALL, start_data);
+		else
+			add_network_persistent(comm, __MPI_GATHER_INIT, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request(__MPI_GATHER_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Gatherv_init(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_persistent(comm, __MPI_GATHERV_INIT, NULL, NULL, MPI_NONE, recvcounts, &recvtype, MPI_ALLV, start_data);
+		else
+			add_network_persistent(comm, __MPI_GATHERV_INIT, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request(__MPI_GATHERV_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Reduce_init(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_persistent(comm, __MPI_REDUCE_INIT, NULL, NULL, MPI_NONE, &count, &datatype, MPI_ALL, start_data);
+		else
+			add_network_persistent(comm, __MPI_REDUCE_INIT, &count, &datatype, root, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request(__MPI_REDUCE_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Reduce_scatter_init(const void *sendbuf, void *recvbuf, const int recvcounts[], MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network_persistent(comm, __MPI_REDUCE_SCATTER_INIT, recvcounts, &datatype, MPI_ALLV, recvcounts, &datatype, MPI_ALLV, start_data);
+		else
+			add_network_persistent(comm, __MPI_REDUCE_SCATTER_INIT, &recvcounts[my_rank], &datatype, 0, &recvcounts[my_rank], &datatype, 0, start_data);
+	after
+		add_request(__MPI_REDUCE_SCATTER_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Reduce_scatter_block_init(const void *sendbuf, void *recvbuf, int recvcount, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network_persistent(comm, __MPI_REDUCE_SCATTER_BLOCK_INIT, &recvcount, &datatype, MPI_ALL, &recvcount, &datatype, MPI_ALLV, start_data);
+		else
+			add_network_persistent(comm, __MPI_REDUCE_SCATTER_BLOCK_INIT, &recvcount, &datatype, 0, &recvcount, &datatype, 0, start_data);
+	after
+		add_request(__MPI_REDUCE_SCATTER_BLOCK_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Scan_init(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+	after
+		add_request(__MPI_SCAN_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Scatter_init(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_persistent(comm, __MPI_SCATTER_INIT, &sendcount, &sendtype, MPI_ALL, NULL, NULL, MPI_NONE, start_data);
+		else
+			add_network_persistent(comm, __MPI_SCATTER_INIT, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root, start_data);
+	after
+		add_request(__MPI_SCATTER_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Scatterv_init(const void *sendbuf, const int sendcounts[], const int displs[], MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_persistent(comm, __MPI_SCATTERV_INIT, sendcounts, &sendtype, MPI_ALLV, NULL, NULL, MPI_NONE, start_data);
+		else
+			add_network_persistent(comm, __MPI_SCATTERV_INIT, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root, start_data);
+	after
+		add_request(__MPI_SCATTERV_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Neighbor_allgather_init(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+	after
+		add_request(__MPI_NEIGHBOR_ALLGATHER_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Neighbor_allgatherv_init(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int displs[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+	after
+		add_request(__MPI_NEIGHBOR_ALLGATHERV_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Neighbor_alltoall_init(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+	after
+		add_request(__MPI_NEIGHBOR_ALLTOALL_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Neighbor_alltoallv_init(const void *sendbuf, const int sendcounts[], const int sdispls[], MPI_Datatype sendtype, void *recvbuf, const int recvcounts[], const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+	after
+		add_request(__MPI_NEIGHBOR_ALLTOALLV_INIT, *request, MPI_ALL, start_data);
+
+collective MPI_Neighbor_alltoallw_init(const void *sendbuf, const int sendcounts[], const MPI_Aint sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const int recvcounts[], const MPI_Aint rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2] = {0, 0};
+	after
+		add_request(__MPI_NEIGHBOR_ALLTOALLW_INIT, *request, MPI_ALL, start_data);
+
+// MPI-4 partitioned communication
+p2p MPI_Psend_init(const void *buf, int partitions, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	debug RANK:%d dest
+	before
+		uint64_t start_data[2] = {0, 0};
+		MPI_Count total_count = partitions * count;
+		add_network_persistent_c(comm, __MPI_PSEND_INIT, &total_count, &datatype, dest, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request_p2p_init(__MPI_PSEND_INIT, comm, *request, dest, start_data);
+
+p2p MPI_Precv_init(void *buf, int partitions, MPI_Count count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Info info, MPI_Request *request)
+	comm comm
+	debug RANK:%d source
+	before
+		uint64_t start_data[2] = {0, 0};
+		MPI_Count total_count = partitions * count;
+		add_network_persistent_c(comm, __MPI_PRECV_INIT, NULL, NULL, MPI_NONE, &total_count, &datatype, source, start_data);
+	after
+		add_request_p2p_init(__MPI_PRECV_INIT, comm, *request, source, start_data);
+
+p2p MPI_Pready(int partition, MPI_Request request)
+
+p2p MPI_Pready_range(int partition_low, int partition_high, MPI_Request request)
+
+p2p MPI_Pready_list(int length, const int array_of_partitions[], MPI_Request request)
+
+polling MPI_Parrived(MPI_Request request, int partition, int *flag)
+	after
+		set_poll_result(*flag);
+
+section mpi4
+
+// MPI-4 large-count bindings: same EAM and profiling of their int
+// counterparts, accounted under the same MPI type with 64-bit counts
+// Point-to-point
+p2p MPI_Send_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network_c(comm, __MPI_SEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+
+p2p MPI_Sendrecv_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, int dest, int sendtag, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, int source, int recvtag, MPI_Comm comm, MPI_Status *status)
+	comm comm
+	debug FROM_RANK:%d-TO_RANK:%d source, dest
+	before
+		add_network_c(comm, __MPI_SENDRECV, &sendcount, &sendtype, dest, &recvcount, &recvtype, source);
+
+p2p MPI_Sendrecv_replace_c(void * buf, MPI_Count count, MPI_Datatype datatype, int dest, int sendtag, int source, int recvtag, MPI_Comm comm, MPI_Status *status)
+	comm comm
+	debug FROM_RANK:%d-TO_RANK:%d source, dest
+	before
+		add_network_c(comm, __MPI_SENDRECV_REPLACE, &count, &datatype, dest, &count, &datatype, source);
+
+p2p MPI_Ssend_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network_c(comm, __MPI_SSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+
+p2p MPI_Bsend_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network_c(comm, __MPI_BSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+
+p2p MPI_Rsend_c(const void *ibuf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network_c(comm, __MPI_RSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+
+p2p MPI_Recv_c(void *buf, MPI_Count count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status)
+	comm comm
+	debug RANK:%d source
+	before
+		add_network_c(comm, __MPI_RECV, NULL, NULL, MPI_NONE, &count, &datatype, source);
+
+p2p MPI_Isend_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network_c(comm, __MPI_ISEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_ISEND, *request, dest, NULL);
+
+p2p MPI_Issend_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network_c(comm, __MPI_ISSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_ISSEND, *request, dest, NULL);
+
+p2p MPI_Irsend_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network_c(comm, __MPI_IRSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IRSEND, *request, dest, NULL);
+
+p2p MPI_Ibsend_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d dest
+	before
+		add_network_c(comm, __MPI_IBSEND, &count, &datatype, dest, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IBSEND, *request, dest, NULL);
+
+p2p MPI_Irecv_c(void *buf, MPI_Count count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	debug RANK:%d source
+	before
+		add_network_c(comm, __MPI_IRECV, NULL, NULL, MPI_NONE, &count, &datatype, source);
+	after
+		add_request(__MPI_IRECV, *request, source, NULL);
+
+p2p MPI_Mrecv_c(void *buf, MPI_Count count, MPI_Datatype type, MPI_Message *message, MPI_Status *status)
+
+p2p MPI_Imrecv_c(void *buf, MPI_Count count, MPI_Datatype type, MPI_Message *message, MPI_Request *request)
+	after
+		add_request(__MPI_IMRECV, *request, MPI_NONE, NULL);
+
+p2p MPI_Send_init_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent_c(comm, __MPI_SEND_INIT, &count, &datatype, dest, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request_p2p_init(__MPI_SEND_INIT, comm, *request, dest, start_data);
+
+p2p MPI_Bsend_init_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent_c(comm, __MPI_BSEND_INIT, &count, &datatype, dest, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request_p2p_init(__MPI_BSEND_INIT, comm, *request, dest, start_data);
+
+p2p MPI_Rsend_init_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent_c(comm, __MPI_RSEND_INIT, &count, &datatype, dest, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request_p2p_init(__MPI_RSEND_INIT, comm, *request, dest, start_data);
+
+p2p MPI_Ssend_init_c(const void *buf, MPI_Count count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent_c(comm, __MPI_SSEND_INIT, &count, &datatype, dest, NULL, NULL, MPI_NONE, start_data);
+	after
+		add_request_p2p_init(__MPI_SSEND_INIT, comm, *request, dest, start_data);
+
+p2p MPI_Recv_init_c(void *buf, MPI_Count count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		uint64_t start_data[2];
+		add_network_persistent_c(comm, __MPI_RECV_INIT, NULL, NULL, MPI_NONE, &count, &datatype, source, start_data);
+	after
+		add_request_p2p_init(__MPI_RECV_INIT, comm, *request, source, start_data);
+
+// Collectives
+collective MPI_Allgather_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	before
+		add_network_c(comm, __MPI_ALLGATHER, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL);
+
+collective MPI_Allgatherv_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint displs[], MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	before
+		add_network_c(comm, __MPI_ALLGATHERV, &sendcount, &sendtype, MPI_ALL, recvcounts, &recvtype, MPI_ALLV);
+
+collective MPI_Allreduce_c(const void *sendbuf, void *recvbuf, MPI_Count count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+	before
+		add_network_c(comm, __MPI_ALLREDUCE, &count, &datatype, MPI_ALL, &count, &datatype, MPI_ALL);
+
+collective MPI_Alltoall_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	before
+		add_network_c(comm, __MPI_ALLTOALL, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL);
+
+collective MPI_Alltoallv_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint sdispls[], MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint rdispls[], MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+	before
+		add_network_c(comm, __MPI_ALLTOALLV, sendcounts, &sendtype, MPI_ALLV, recvcounts, &recvtype, MPI_ALLV);
+
+collective MPI_Alltoallw_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm)
+	comm comm
+	before
+		add_network_c(comm, __MPI_ALLTOALLW, sendcounts, (MPI_Datatype*) sendtypes, MPI_ALLW, recvcounts, (MPI_Datatype*) recvtypes, MPI_ALLW);
+
+collective MPI_Bcast_c(void *buffer, MPI_Count count, MPI_Datatype datatype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_BCAST, &count, &datatype, MPI_ALL, NULL, &datatype, MPI_NONE);
+		else
+			add_network_c(comm, __MPI_BCAST, NULL, NULL, MPI_NONE, &count, &datatype, root);
+
+collective MPI_Exscan_c(const void *sendbuf, void *recvbuf, MPI_Count count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+
+collective MPI_Gather_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_GATHER, NULL, NULL, MPI_NONE, &recvcount, &recvtype, MPI_ALL);
+		else
+			add_network_c(comm, __MPI_GATHER, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE);
+
+collective MPI_Gatherv_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint displs[], MPI_Datatype recvtype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_GATHERV, NULL, NULL, MPI_NONE, recvcounts, &recvtype, MPI_ALLV);
+		else
+			add_network_c(comm, __MPI_GATHERV, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE);
+
+collective MPI_Reduce_c(const void *sendbuf, void *recvbuf, MPI_Count count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_REDUCE, NULL, NULL, MPI_NONE, &count, &datatype, MPI_ALL);
+		else
+			add_network_c(comm, __MPI_REDUCE, &count, &datatype, root, NULL, NULL, MPI_NONE);
+
+collective MPI_Reduce_scatter_c(const void *sendbuf, void *recvbuf, const MPI_Count recvcounts[], MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network_c(comm, __MPI_REDUCE_SCATTER, recvcounts, &datatype, MPI_ALLV, recvcounts, &datatype, MPI_ALLV);
+		else
+			add_network_c(comm, __MPI_REDUCE_SCATTER, &recvcounts[my_rank], &datatype, 0, &recvcounts[my_rank], &datatype, 0);
+
+collective MPI_Reduce_scatter_block_c(const void *sendbuf, void *recvbuf, MPI_Count recvcount, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network_c(comm, __MPI_REDUCE_SCATTER_BLOCK, &recvcount, &datatype, MPI_ALL, &recvcount, &datatype, MPI_ALLV);
+		else
+			add_network_c(comm, __MPI_REDUCE_SCATTER_BLOCK, &recvcount, &datatype, 0, &recvcount, &datatype, 0);
+
+collective MPI_Scan_c(const void *sendbuf, void *recvbuf, MPI_Count count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
+	comm comm
+
+collective MPI_Scatter_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_SCATTER, &sendcount, &sendtype, MPI_ALL, NULL, NULL, MPI_NONE);
+		else
+			add_network_c(comm, __MPI_SCATTER, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root);
+
+collective MPI_Scatterv_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint displs[], MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_SCATTERV, sendcounts, &sendtype, MPI_ALLV, NULL, NULL, MPI_NONE);
+		else
+			add_network_c(comm, __MPI_SCATTERV, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root);
+
+collective MPI_Iallgather_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network_c(comm, __MPI_IALLGATHER, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL);
+	after
+		add_request(__MPI_IALLGATHER, *request, MPI_ALL, NULL);
+
+collective MPI_Iallgatherv_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint displs[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network_c(comm, __MPI_IALLGATHERV, &sendcount, &sendtype, MPI_ALL, recvcounts, &recvtype, MPI_ALLV);
+	after
+		add_request(__MPI_IALLGATHERV, *request, MPI_ALL, NULL);
+
+collective MPI_Iallreduce_c(const void *sendbuf, void *recvbuf, MPI_Count count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network_c(comm, __MPI_IALLREDUCE, &count, &datatype, MPI_ALL, &count, &datatype, MPI_ALL);
+	after
+		add_request(__MPI_IALLREDUCE, *request, MPI_ALL, NULL);
+
+collective MPI_Ialltoall_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network_c(comm, __MPI_IALLTOALL, &sendcount, &sendtype, MPI_ALL, &recvcount, &recvtype, MPI_ALL);
+	after
+		add_request(__MPI_IALLTOALL, *request, MPI_ALL, NULL);
+
+collective MPI_Ialltoallv_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint sdispls[], MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint rdispls[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network_c(comm, __MPI_IALLTOALLV, sendcounts, &sendtype, MPI_ALLV, recvcounts, &recvtype, MPI_ALLV);
+	after
+		add_request(__MPI_IALLTOALLV, *request, MPI_ALL, NULL);
+
+collective MPI_Ialltoallw_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		add_network_c(comm, __MPI_IALLTOALLW, sendcounts, (MPI_Datatype*) sendtypes, MPI_ALLW, recvcounts, (MPI_Datatype*) recvtypes, MPI_ALLW);
+	after
+		add_request(__MPI_IALLTOALLW, *request, MPI_ALL, NULL);
+
+collective MPI_Ibcast_c(void *buffer, MPI_Count count, MPI_Datatype datatype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_IBCAST, &count, &datatype, MPI_ALL, NULL, NULL, MPI_NONE);
+		else
+			add_network_c(comm, __MPI_IBCAST, NULL, NULL, MPI_NONE, &count, &datatype, root);
+	after
+		add_request(__MPI_IBCAST, *request, MPI_ALL, NULL);
+
+collective MPI_Iexscan_c(const void *sendbuf, void *recvbuf, MPI_Count count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_IEXSCAN, *request, MPI_ALL, NULL);
+
+collective MPI_Igather_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_IGATHER, NULL, NULL, MPI_NONE, &recvcount, &recvtype, MPI_ALL);
+		else
+			add_network_c(comm, __MPI_IGATHER, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IGATHER, *request, MPI_ALL, NULL);
+
+collective MPI_Igatherv_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint displs[], MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_IGATHERV, NULL, NULL, MPI_NONE, recvcounts, &recvtype, MPI_ALLV);
+		else
+			add_network_c(comm, __MPI_IGATHERV, &sendcount, &sendtype, root, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IGATHERV, *request, MPI_ALL, NULL);
+
+collective MPI_Ireduce_c(const void *sendbuf, void *recvbuf, MPI_Count count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_IREDUCE, NULL, NULL, MPI_NONE, &count, &datatype, MPI_ALL);
+		else
+			add_network_c(comm, __MPI_IREDUCE, &count, &datatype, root, NULL, NULL, MPI_NONE);
+	after
+		add_request(__MPI_IREDUCE, *request, MPI_ALL, NULL);
+
+collective MPI_Ireduce_scatter_c(const void *sendbuf, void *recvbuf, const MPI_Count recvcounts[], MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network_c(comm, __MPI_IREDUCE_SCATTER, recvcounts, &datatype, MPI_ALLV, recvcounts, &datatype, MPI_ALLV);
+		else
+			add_network_c(comm, __MPI_IREDUCE_SCATTER, &recvcounts[my_rank], &datatype, 0, &recvcounts[my_rank], &datatype, 0);
+	after
+		add_request(__MPI_IREDUCE_SCATTER, *request, MPI_ALL, NULL);
+
+collective MPI_Ireduce_scatter_block_c(const void *sendbuf, void *recvbuf, MPI_Count recvcount, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == 0)
+			add_network_c(comm, __MPI_IREDUCE_SCATTER_BLOCK, &recvcount, &datatype, MPI_ALL, &recvcount, &datatype, MPI_ALLV);
+		else
+			add_network_c(comm, __MPI_IREDUCE_SCATTER_BLOCK, &recvcount, &datatype, 0, &recvcount, &datatype, 0);
+	after
+		add_request(__MPI_IREDUCE_SCATTER_BLOCK, *request, MPI_ALL, NULL);
+
+collective MPI_Iscan_c(const void *sendbuf, void *recvbuf, MPI_Count count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_ISCAN, *request, MPI_ALL, NULL);
+
+collective MPI_Iscatter_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_ISCATTER, &sendcount, &sendtype, MPI_ALL, NULL, NULL, MPI_NONE);
+		else
+			add_network_c(comm, __MPI_ISCATTER, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root);
+	after
+		add_request(__MPI_ISCATTER, *request, MPI_ALL, NULL);
+
+collective MPI_Iscatterv_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint displs[], MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	before
+		int my_rank;
+		PMPI_Comm_rank(comm, &my_rank);
+		if(my_rank == root)
+			add_network_c(comm, __MPI_ISCATTERV, sendcounts, &sendtype, MPI_ALLV, NULL, NULL, MPI_NONE);
+		else
+			add_network_c(comm, __MPI_ISCATTERV, NULL, NULL, MPI_NONE, &recvcount, &recvtype, root);
+	after
+		add_request(__MPI_ISCATTERV, *request, MPI_ALL, NULL);
+
+collective MPI_Neighbor_allgather_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+
+collective MPI_Neighbor_allgatherv_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint displs[], MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+
+collective MPI_Neighbor_alltoall_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+
+collective MPI_Neighbor_alltoallv_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint sdispls[], MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint rdispls[], MPI_Datatype recvtype, MPI_Comm comm)
+	comm comm
+
+collective MPI_Neighbor_alltoallw_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm)
+	comm comm
+
+collective MPI_Ineighbor_allgather_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLGATHER, *request, MPI_ALL, NULL);
+
+collective MPI_Ineighbor_allgatherv_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint displs[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLGATHERV, *request, MPI_ALL, NULL);
+
+collective MPI_Ineighbor_alltoall_c(const void *sendbuf, MPI_Count sendcount, MPI_Datatype sendtype, void *recvbuf, MPI_Count recvcount, MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLTOALL, *request, MPI_ALL, NULL);
+
+collective MPI_Ineighbor_alltoallv_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint sdispls[], MPI_Datatype sendtype, void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint rdispls[], MPI_Datatype recvtype, MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLTOALLV, *request, MPI_ALL, NULL);
+
+collective MPI_Ineighbor_alltoallw_c(const void *sendbuf, const MPI_Count sendcounts[], const MPI_Aint sdispls[], const MPI_Datatype sendtypes[], void *recvbuf, const MPI_Count recvcounts[], const MPI_Aint rdispls[], const MPI_Datatype recvtypes[], MPI_Comm comm, MPI_Request *request)
+	comm comm
+	after
+		add_request(__MPI_INEIGHBOR_ALLTOALLW, *request, MPI_ALL, NULL);
+
+// One-sided
+rma MPI_Put_c(const void *origin_addr, MPI_Count origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, MPI_Count target_count, MPI_Datatype target_datatype, MPI_Win win)
+
+rma MPI_Get_c(void *origin_addr, MPI_Count origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, MPI_Count target_count, MPI_Datatype target_datatype, MPI_Win win)
+
+rma MPI_Accumulate_c(const void *origin_addr, MPI_Count origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, MPI_Count target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win)
+
+rma MPI_Get_accumulate_c(const void *origin_addr, MPI_Count origin_count, MPI_Datatype origin_datatype, void *result_addr, MPI_Count result_count, MPI_Datatype result_datatype, int target_rank, MPI_Aint target_disp, MPI_Count target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win)
+
+rma MPI_Rput_c(const void *origin_addr, MPI_Count origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, MPI_Count target_count, MPI_Datatype target_datatype, MPI_Win win, MPI_Request *request)
+	after
+		add_request(__MPI_RPUT, *request, target_rank, NULL);
+
+rma MPI_Rget_c(void *origin_addr, MPI_Count origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, MPI_Count target_count, MPI_Datatype target_datatype, MPI_Win win, MPI_Request *request)
+	after
+		add_request(__MPI_RGET, *request, target_rank, NULL);
+
+rma MPI_Raccumulate_c(const void *origin_addr, MPI_Count origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp, MPI_Count target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win, MPI_Request *request)
+	after
+		add_request(__MPI_RACCUMULATE, *request, target_rank, NULL);
+
+rma MPI_Rget_accumulate_c(const void *origin_addr, MPI_Count origin_count, MPI_Datatype origin_datatype, void *result_addr, MPI_Count result_count, MPI_Datatype result_datatype, int target_rank, MPI_Aint target_disp, MPI_Count target_count, MPI_Datatype target_datatype, MPI_Op op, MPI_Win win, MPI_Request *request)
+	after
+		add_request(__MPI_RGET_ACCUMULATE, *request, target_rank, NULL);
+
+rma MPI_Win_allocate_c(MPI_Aint size, MPI_Aint disp_unit, MPI_Info info, MPI_Comm comm, void *baseptr, MPI_Win *win)
+	comm comm
+
+rma MPI_Win_allocate_shared_c(MPI_Aint size, MPI_Aint disp_unit, MPI_Info info, MPI_Comm comm, void *baseptr, MPI_Win *win)
+	comm comm
+
+rma MPI_Win_create_c(void *base, MPI_Aint size, MPI_Aint disp_unit, MPI_Info info, MPI_Comm comm, MPI_Win *win)
+	comm comm
+
+accessory MPI_Win_shared_query_c(MPI_Win win, int rank, MPI_Aint *size, MPI_Aint *disp_unit, void *baseptr)
+
+// I/O
+io MPI_File_read_c(MPI_File fh, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ, count, datatype, 0, 0);
+
+io MPI_File_read_all_c(MPI_File fh, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_ALL, count, datatype, 0, 0);
+
+io MPI_File_read_at_c(MPI_File fh, MPI_Offset offset, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_AT, count, datatype, 0, 0);
+
+io MPI_File_read_at_all_c(MPI_File fh, MPI_Offset offset, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_AT_ALL, count, datatype, 0, 0);
+
+io MPI_File_read_shared_c(MPI_File fh, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_SHARED, count, datatype, 0, 0);
+
+io MPI_File_read_ordered_c(MPI_File fh, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_READ_ORDERED, count, datatype, 0, 0);
+
+io MPI_File_write_c(MPI_File fh, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE, 0, 0, count, datatype);
+
+io MPI_File_write_all_c(MPI_File fh, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_ALL, 0, 0, count, datatype);
+
+io MPI_File_write_at_c(MPI_File fh, MPI_Offset offset, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_AT, 0, 0, count, datatype);
+
+io MPI_File_write_at_all_c(MPI_File fh, MPI_Offset offset, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_AT_ALL, 0, 0, count, datatype);
+
+io MPI_File_write_shared_c(MPI_File fh, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_SHARED, 0, 0, count, datatype);
+
+io MPI_File_write_ordered_c(MPI_File fh, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Status *status)
+	before
+		add_file(__MPI_FILE_WRITE_ORDERED, 0, 0, count, datatype);
+
+io MPI_File_iread_c(MPI_File fh, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD, *request, MPI_NONE, NULL);
+
+io MPI_File_iread_all_c(MPI_File fh, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD_ALL, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD_ALL, *request, MPI_NONE, NULL);
+
+io MPI_File_iread_at_c(MPI_File fh, MPI_Offset offset, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD_AT, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD_AT, *request, MPI_NONE, NULL);
+
+io MPI_File_iread_at_all_c(MPI_File fh, MPI_Offset offset, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD_AT_ALL, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD_AT_ALL, *request, MPI_NONE, NULL);
+
+io MPI_File_iread_shared_c(MPI_File fh, void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IREAD_SHARED, count, datatype, 0, 0);
+	after
+		add_request(__MPI_FILE_IREAD_SHARED, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite_c(MPI_File fh, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite_all_c(MPI_File fh, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE_ALL, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE_ALL, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite_at_c(MPI_File fh, MPI_Offset offset, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE_AT, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE_AT, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite_at_all_c(MPI_File fh, MPI_Offset offset, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE_AT_ALL, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE_AT_ALL, *request, MPI_NONE, NULL);
+
+io MPI_File_iwrite_shared_c(MPI_File fh, const void *buf, MPI_Count count, MPI_Datatype datatype, MPI_Request *request)
+	before
+		add_file(__MPI_FILE_IWRITE_SHARED, 0, 0, count, datatype);
+	after
+		add_request(__MPI_FILE_IWRITE_SHARED, *request, MPI_NONE, NULL);
+
+io MPI_File_read_all_begin_c(MPI_File fh, void *buf, MPI_Count count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_READ_ALL_BEGIN, count, datatype, 0, 0);
+
+io MPI_File_read_at_all_begin_c(MPI_File fh, MPI_Offset offset, void *buf, MPI_Count count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_READ_AT_ALL_BEGIN, count, datatype, 0, 0);
+
+io MPI_File_read_ordered_begin_c(MPI_File fh, void *buf, MPI_Count count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_READ_ORDERED_BEGIN, count, datatype, 0, 0);
+
+io MPI_File_write_all_begin_c(MPI_File fh, const void *buf, MPI_Count count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_WRITE_ALL_BEGIN, 0, 0, count, datatype);
+
+io MPI_File_write_at_all_begin_c(MPI_File fh, MPI_Offset offset, const void *buf, MPI_Count count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_WRITE_AT_ALL_BEGIN, 0, 0, count, datatype);
+
+io MPI_File_write_ordered_begin_c(MPI_File fh, const void *buf, MPI_Count count, MPI_Datatype datatype)
+	before
+		add_file(__MPI_FILE_WRITE_ORDERED_BEGIN, 0, 0, count, datatype);
+
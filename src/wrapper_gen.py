@@ -0,0 +1,494 @@
+#!/usr/bin/env python3
+#
+# Copyright (c), CINECA, UNIBO, and ETH Zurich
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#			* Redistributions of source code must retain the above copyright notice, this
+#				list of conditions and the following disclaimer.
+#
+#			* Redistributions in binary form must reproduce the above copyright notice,
+#				this list of conditions and the following disclaimer in the documentation
+#				and/or other materials provided with the distribution.
+#
+#			* Neither the name of the copyright holder nor the names of its
+#				contributors may be used to endorse or promote products derived from
+#				this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Generate the C/C++ and Fortran PMPI wrappers of COUNTDOWN from wrapper.spec
+#
+# Usage: wrapper_gen.py <wrapper.spec> <C output> <Fortran output>
+
+import re
+import sys
+
+CLASSES = ('collective', 'p2p', 'wait', 'rma', 'io', 'accessory', 'polling')
+KINDS = CLASSES + ('init', 'finalize', 'query')
+
+# Preprocessor guard and parent section of each section
+SECTIONS = {
+	'core': (None, None, None),
+	'profiling': ('#ifndef DISABLE_PROFILING_MPI', '#endif // DISABLE_PROFILING_MPI', None),
+	'p2p': ('#ifndef DISABLE_P2P_MPI', '#endif // DISABLE_P2P_MPI', 'profiling'),
+	'accessory': ('#ifndef DISABLE_ACCESSORY_MPI', '#endif // DISABLE_ACCESSORY_MPI', 'profiling'),
+	'persistent': ('#if defined(HAVE_MPI4_PERSISTENT) && !defined(DISABLE_PROFILING_MPI)', '#endif // HAVE_MPI4_PERSISTENT', None),
+	'mpi4': ('#if MPI_VERSION >= 4 && !defined(DISABLE_PROFILING_MPI)', '#endif // MPI_VERSION >= 4', None),
+}
+
+BLOCKS = ('before', 'after', 'fbefore', 'fafter')
+
+# Name mangling of the legacy Fortran bindings, as exported by Open MPI and by
+# the MPICH derived MPIs (MPICH, Intel MPI, Cray MPICH, MVAPICH)
+MANGLING = (
+	('Lowercase', lambda name: name.lower()),
+	('Lowercase - single underscore', lambda name: name.lower() + '_'),
+	('Lowercase - double underscore', lambda name: name.lower() + '__'),
+	('Uppercase', lambda name: name.upper()))
+
+# Suffixes of the symbols of the Fortran 2008 bindings
+F08_SUFFIXES = ('_f08', '_f08ts')
+
+
+class SpecError(Exception):
+	pass
+
+
+class Function:
+	def __init__(self, kind, name, args, section, comments, line):
+		self.kind = kind
+		self.name = name
+		self.args = args
+		self.section = section
+		self.comments = comments
+		self.line = line
+		self.comm = 'MPI_COMM_WORLD'
+		self.eam = False
+		self.debug_fmt = ''
+		self.debug_args = []
+		self.fargs = None
+		self.code = dict((block, []) for block in BLOCKS)
+
+	@property
+	def mpi_type(self):
+		return '__' + re.sub(r'_c$', '', self.name).upper()
+
+	@property
+	def flags(self):
+		if self.kind == 'init':
+			return 'CALL_ACCESSORY'
+		if self.kind == 'finalize':
+			return 'CALL_ACCESSORY | CALL_EAM'
+		flags = 'CALL_' + self.kind.upper()
+		if self.eam:
+			flags += ' | CALL_EAM'
+		return flags
+
+	@property
+	def fcomm(self):
+		if self.comm == 'MPI_COMM_WORLD':
+			return self.comm
+		return 'MPI_Comm_f2c(*%s)' % self.comm.lstrip('*')
+
+
+def split_args(args):
+	parts = []
+	depth = 0
+	cur = ''
+	for ch in args:
+		if ch in '([':
+			depth += 1
+		elif ch in ')]':
+			depth -= 1
+		if ch == ',' and depth == 0:
+			parts.append(cur.strip())
+			cur = ''
+		else:
+			cur += ch
+	if cur.strip():
+		parts.append(cur.strip())
+	return parts
+
+
+# Names of the parameters of a prototype, without the variadic ones
+def arg_names(args):
+	names = []
+	for arg in split_args(args):
+		if arg in ('void', '...'):
+			continue
+		arg = re.sub(r'(\[[^]]*\])+$', '', arg)
+		match = re.search(r'\(\s*\*\s*(\w+)\s*\)', arg) or re.search(r'(\w+)$', arg)
+		if match is None:
+			raise SpecError('cannot parse the argument "%s"' % arg)
+		names.append(match.group(1))
+	return ', '.join(names)
+
+
+def parse_spec(path):
+	functions = []
+	section = None
+	comments = []
+	func = None
+	block = None
+
+	with open(path) as spec:
+		for num, line in enumerate(spec, 1):
+			line = line.rstrip('\r\n')
+			try:
+				if not line.strip() or line.startswith('#'):
+					block = None
+					continue
+				if line.startswith('//'):
+					comments.append(line)
+					func = None
+					continue
+				if line.startswith('\t\t'):
+					if func is None or block is None:
+						raise SpecError('code outside of a block')
+					func.code[block].append(line[1:])
+					continue
+				if line.startswith('\t'):
+					if func is None:
+						raise SpecError('property outside of a function')
+					key, _, value = line.strip().partition(' ')
+					block = None
+					if key in BLOCKS:
+						block = key
+					elif key == 'comm':
+						func.comm = value
+					elif key == 'eam':
+						func.eam = True
+					elif key == 'debug':
+						fmt, _, args = value.partition(' ')
+						func.debug_fmt = fmt
+						func.debug_args = [arg.strip() for arg in args.split(',') if arg.strip()]
+					elif key == 'fortran':
+						func.fargs = value
+					else:
+						raise SpecError('unknown property "%s"' % key)
+					continue
+				key, _, value = line.partition(' ')
+				if key == 'section':
+					if value not in SECTIONS:
+						raise SpecError('unknown section "%s"' % value)
+					section = value
+					func = None
+					continue
+				match = re.match(r'(MPI_\w+)\((.*)\)$', value)
+				if key not in KINDS or match is None:
+					raise SpecError('invalid function "%s"' % line)
+				if section is None:
+					raise SpecError('function outside of a section')
+				func = Function(key, match.group(1), match.group(2), section, comments, num)
+				comments = []
+				functions.append(func)
+			except SpecError as err:
+				raise SpecError('%s:%d: %s' % (path, num, err))
+
+	return functions
+
+
+# The license of the spec as the C comment heading the generated files
+def license_header(path):
+	with open(path) as source:
+		lines = source.read().split('\n')
+	return '\n'.join(['/*'] + [' *' + line[1:] for line in lines[1:28]] + ['*/'])
+
+
+def debug_print(out, func, what, fortran):
+	fmt = func.debug_fmt
+	args = ''.join(', ' + ('*' + arg if fortran else arg) for arg in func.debug_args)
+	out.append('\tprintf("[DEBUG][RANK:%%d] %s %s(%s)\\n", debug_rank%s);'
+		% (what, func.name, fmt, args))
+
+
+def debug_start(out, func, fortran):
+	out.append('#ifdef DEBUG_MPI')
+	out.append('\tint debug_rank;')
+	out.append('\tPMPI_Comm_rank(MPI_COMM_WORLD, &debug_rank);')
+	debug_print(out, func, 'Start', fortran)
+	out.append('#endif')
+
+
+def debug_end(out, func, fortran):
+	out.append('#ifdef DEBUG_MPI')
+	debug_print(out, func, 'End', fortran)
+	out.append('#endif')
+
+
+def gen_c_function(out, func):
+	names = arg_names(func.args)
+	pmpi = 'P%s(%s)' % (func.name, names)
+
+	out.extend(func.comments)
+	out.append('int %s(%s)' % (func.name, func.args))
+	out.append('{')
+	if func.kind == 'query':
+		out.append('\treturn %s;' % pmpi)
+	elif func.kind == 'init':
+		out.append('\tif(cntd_thread.fortran_nested)')
+		out.append('\t\treturn %s;' % pmpi)
+		out.append('\tint ret = %s;' % pmpi)
+		debug_start(out, func, False)
+		out.append('\tstart_cntd();')
+		out.append('\tcall_start(%s, MPI_COMM_WORLD, CALLER_ADDR, %s);' % (func.mpi_type, func.flags))
+		out.append('\tcall_end(%s, MPI_COMM_WORLD, CALLER_ADDR, %s);' % (func.mpi_type, func.flags))
+		debug_end(out, func, False)
+		out.append('\treturn ret;')
+	elif func.kind == 'finalize':
+		out.append('\tif(cntd_thread.fortran_nested)')
+		out.append('\t\treturn %s;' % pmpi)
+		debug_start(out, func, False)
+		out.append('\tcall_start(%s, MPI_COMM_WORLD, CALLER_ADDR, %s);' % (func.mpi_type, func.flags))
+		out.append('')
+		out.append('\tPMPI_Barrier(MPI_COMM_WORLD);')
+		out.append('')
+		out.append('\tcall_end(%s, MPI_COMM_WORLD, CALLER_ADDR, %s);' % (func.mpi_type, func.flags))
+		out.append('')
+		out.append('\tstop_cntd();')
+		debug_end(out, func, False)
+		out.append('\treturn %s;' % pmpi)
+	else:
+		out.append('\tif(!mpi_type_instr[%s] || cntd_thread.fortran_nested)' % func.mpi_type)
+		out.append('\t\treturn %s;' % pmpi)
+		debug_start(out, func, False)
+		out.append('\tcall_start(%s, %s, CALLER_ADDR, %s);' % (func.mpi_type, func.comm, func.flags))
+		out.extend(func.code['before'])
+		out.append('\tint ret = %s;' % pmpi)
+		out.extend(func.code['after'])
+		out.append('\tcall_end(%s, %s, CALLER_ADDR, %s);' % (func.mpi_type, func.comm, func.flags))
+		debug_end(out, func, False)
+		out.append('\treturn ret;')
+	out.append('}')
+	out.append('')
+
+
+# The PMPI entry point is a parameter of the FMPI_ body, so that the legacy and
+# the mpi_f08 symbols share it while calling their own profiling interface
+def fortran_pmpi(func):
+	return 'pmpi(%s)' % arg_names(func.fargs)
+
+
+# The Fortran bindings of the MPICH derived MPIs call the C MPI_ functions,
+# which forward to PMPI while the flag is set so the call is accounted once
+def fortran_nested_call(out, pmpi, indent):
+	out.append(indent + 'cntd_thread.fortran_nested = TRUE;')
+	out.append(indent + '%s;' % pmpi)
+	out.append(indent + 'cntd_thread.fortran_nested = FALSE;')
+
+
+def gen_fortran_function(out, func):
+	pmpi = fortran_pmpi(func)
+
+	out.append('FMPI_INLINE void F%s(__typeof__(p%s_) *pmpi, %s)'
+		% (func.name, func.name.lower(), func.fargs))
+	out.append('{')
+	if func.kind == 'query':
+		fortran_nested_call(out, pmpi, '\t')
+	elif func.kind == 'init':
+		fortran_nested_call(out, pmpi, '\t')
+		debug_start(out, func, True)
+		out.append('\tstart_cntd();')
+		out.append('\tcall_start(%s, MPI_COMM_WORLD, CALLER_ADDR, %s);' % (func.mpi_type, func.flags))
+		out.append('\tcall_end(%s, MPI_COMM_WORLD, CALLER_ADDR, %s);' % (func.mpi_type, func.flags))
+		debug_end(out, func, True)
+	elif func.kind == 'finalize':
+		debug_start(out, func, True)
+		out.append('\tcall_start(%s, MPI_COMM_WORLD, CALLER_ADDR, %s);' % (func.mpi_type, func.flags))
+		out.append('')
+		out.append('\tPMPI_Barrier(MPI_COMM_WORLD);')
+		out.append('')
+		out.append('\tcall_end(%s, MPI_COMM_WORLD, CALLER_ADDR, %s);' % (func.mpi_type, func.flags))
+		out.append('\tstop_cntd();')
+		debug_end(out, func, True)
+		out.append('')
+		fortran_nested_call(out, pmpi, '\t')
+	else:
+		out.append('\tif(!mpi_type_instr[%s])' % func.mpi_type)
+		out.append('\t{')
+		fortran_nested_call(out, pmpi, '\t\t')
+		out.append('\t\treturn;')
+		out.append('\t}')
+		debug_start(out, func, True)
+		out.append('\tcall_start(%s, %s, CALLER_ADDR, %s);' % (func.mpi_type, func.fcomm, func.flags))
+		out.extend(func.code['fbefore'])
+		fortran_nested_call(out, pmpi, '\t')
+		out.extend(func.code['fafter'])
+		out.append('\tcall_end(%s, %s, CALLER_ADDR, %s);' % (func.mpi_type, func.fcomm, func.flags))
+		debug_end(out, func, True)
+	out.append('}')
+	out.append('')
+
+
+# Exported symbols of the Fortran ABIs, all inlining the same FMPI_ body. Each
+# symbol calls the PMPI symbol with its own mangling, the only one an MPI built
+# for a single Fortran name mangling provides
+def gen_fortran_symbols(out, functions):
+	out.append('// FORTRAN ABI Interfaces')
+	for title, mangle in MANGLING:
+		out.append('// ' + title)
+		for func in functions:
+			out.append('void %s(%s)' % (mangle(func.name), func.fargs))
+			out.append('{')
+			out.append('\tF%s(%s, %s);' % (func.name, mangle('P' + func.name), arg_names(func.fargs)))
+			out.append('}')
+			out.append('')
+
+	# Open MPI names the mpi_f08 procedures MPI_X_f08, MPICH names MPI_X_f08ts
+	# the ones with a choice buffer, both mangled by the Fortran compiler. The
+	# arguments are forwarded untouched: the optional ierror may be NULL, so
+	# the Fortran code never dereferences ierr, and the buffers of the _f08ts
+	# procedures are descriptors, never dereferenced either
+	out.append('// FORTRAN 2008 Interfaces (mpi_f08)')
+	for suffix in F08_SUFFIXES:
+		out.append('// Suffix ' + suffix)
+		for func in functions:
+			name = '%s%s_' % (func.name.lower(), suffix)
+			out.append('void %s(%s)' % (name, func.fargs))
+			out.append('{')
+			out.append('\tF%s(p%s, %s);' % (func.name, name, arg_names(func.fargs)))
+			out.append('}')
+			out.append('')
+
+
+# Emit the functions grouped by section, nesting the guards of the sections
+def gen_sections(out, functions, gen_section):
+	open_sections = []
+	groups = []
+	for func in functions:
+		if not groups or groups[-1][0] != func.section:
+			groups.append((func.section, []))
+		groups[-1][1].append(func)
+
+	for section, funcs in groups:
+		guard, _, parent = SECTIONS[section]
+		while open_sections and open_sections[-1] != parent:
+			out.append(SECTIONS[open_sections.pop()][1])
+			out.append('')
+		if parent is not None and parent not in open_sections:
+			out.append(SECTIONS[parent][0])
+			out.append('')
+			open_sections.append(parent)
+		if guard is not None:
+			out.append(guard)
+			out.append('')
+			open_sections.append(section)
+		gen_section(out, funcs)
+
+	while open_sections:
+		out.append(SECTIONS[open_sections.pop()][1])
+		out.append('')
+
+
+def gen_c(functions, header):
+	out = [header, '', '// Generated by wrapper_gen.py from wrapper.spec: do not edit', '',
+		'#include "cntd.h"', '']
+
+	def gen_section(out, funcs):
+		for func in funcs:
+			gen_c_function(out, func)
+
+	gen_sections(out, functions, gen_section)
+	return '\n'.join(out).rstrip('\n') + '\n'
+
+
+def gen_fortran(functions, header):
+	functions = [func for func in functions if func.fargs is not None]
+	out = [header, '', '// Generated by wrapper_gen.py from wrapper.spec: do not edit', '',
+		'#include "cntd.h"', '',
+		'#ifdef HAVE_FORTRAN_ABI', '',
+		'// The FMPI_ bodies are inlined in every exported symbol, so CALLER_ADDR is the',
+		'// return address into the application and not into this file',
+		'#define FMPI_INLINE static inline __attribute__((always_inline))', '']
+
+	# The Fortran libraries of the MPI are loaded only by the applications using
+	# them, and not every MPI provides all the manglings and suffixes: the PMPI
+	# symbols are weak references
+	for _, mangle in MANGLING:
+		for func in functions:
+			out.append('extern void %s(%s) __attribute__((weak));'
+				% (mangle('P' + func.name), func.fargs))
+		out.append('')
+	for suffix in F08_SUFFIXES:
+		for func in functions:
+			out.append('extern void p%s%s_(%s) __attribute__((weak));'
+				% (func.name.lower(), suffix, func.fargs))
+		out.append('')
+
+	def gen_section(out, funcs):
+		for func in funcs:
+			gen_fortran_function(out, func)
+		gen_fortran_symbols(out, funcs)
+
+	gen_sections(out, functions, gen_section)
+	out.append('#endif // HAVE_FORTRAN_ABI')
+	return '\n'.join(out) + '\n'
+
+
+def check(functions):
+	names = set()
+	for func in functions:
+		where = 'line %d: %s' % (func.line, func.name)
+		if func.name in names:
+			raise SpecError('%s: duplicated function' % where)
+		names.add(func.name)
+		if func.kind in ('init', 'finalize', 'query'):
+			if func.section != 'core' and func.kind != 'query':
+				raise SpecError('%s: %s outside of the core section' % (where, func.kind))
+		if func.eam and func.kind != 'accessory':
+			raise SpecError('%s: eam is only for accessory functions' % where)
+		if func.fargs is None and (func.code['fbefore'] or func.code['fafter']):
+			raise SpecError('%s: Fortran code without a Fortran binding' % where)
+		if func.fargs is not None and func.section in ('persistent', 'mpi4'):
+			raise SpecError('%s: Fortran binding in a C only section' % where)
+		# ierror is optional in mpi_f08, its address may be NULL
+		if re.search(r'\bierr\b', '\n'.join(func.code['fbefore'] + func.code['fafter'])):
+			raise SpecError('%s: Fortran code using ierr' % where)
+		# gfortran >= 8 and ifort pass the hidden character lengths as size_t
+		if func.fargs is not None and re.search(r'\bMPI_Fint \w+_len\b', func.fargs):
+			raise SpecError('%s: hidden character length not declared size_t' % where)
+
+
+def write_if_changed(path, text):
+	try:
+		with open(path) as old:
+			if old.read() == text:
+				return
+	except IOError:
+		pass
+	with open(path, 'w') as new:
+		new.write(text)
+
+
+def main(argv):
+	if len(argv) != 4:
+		sys.stderr.write('Usage: %s <wrapper.spec> <C output> <Fortran output>\n' % argv[0])
+		return 1
+
+	try:
+		functions = parse_spec(argv[1])
+		check(functions)
+	except SpecError as err:
+		sys.stderr.write('Error: %s\n' % err)
+		return 1
+
+	header = license_header(argv[1])
+	write_if_changed(argv[2], gen_c(functions, header))
+	write_if_changed(argv[3], gen_fortran(functions, header))
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))